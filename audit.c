@@ -0,0 +1,308 @@
+/**
+ * Audit trail of radio state changes.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * Every write grfkill issues and every state change it observes is
+ * stored in a fixed, preallocated ring: who made it (OSD switch, D-Bus,
+ * hotkey, policy, rfkill(8) when /dev/rfkill is not writable, or someone
+ * else entirely), the device, the old and new state, the time from write
+ * to kernel event, and the error of a failed write.
+ * The main loop only copies a record into the ring under a mutex. A
+ * flusher thread sleeps until a batch is ready (or a flush is requested
+ * when the OSD hides, or at exit), then formats the records and appends
+ * them to $XDG_DATA_HOME/grfkill/audit.log.
+ */
+
+#include <glib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "grfkill.h"
+
+#define AUDIT_RING    256
+#define FLUSH_BATCH   32
+#define N_PENDING     8
+#define PENDING_USEC  (2 * G_USEC_PER_SEC)	/* a write the kernel never answered */
+
+typedef struct {
+	gint64  time;		/* wall clock usec */
+	guint32 idx;
+	guint32 latency_usec;	/* write to matching kernel event */
+	gint32  error;		/* errno of a failed write */
+	guint8  initiator;	/* AUDIT_* */
+	guint8  type;
+	guint8  old_state;	/* soft | hard << 1 */
+	guint8  new_state;
+} AuditRecord;
+
+typedef struct {
+	gboolean active;
+	guint32  idx;
+	guint8   initiator;
+	gint64   issued;
+} PendingWrite;
+
+static const gchar *const initiator_names[N_AUDIT_INITIATORS] = {
+	[AUDIT_OSD]      = "osd",
+	[AUDIT_DBUS]     = "dbus",
+	[AUDIT_EXTERNAL] = "external",
+	[AUDIT_HOTKEY]   = "hotkey",
+	[AUDIT_POLICY]   = "policy",
+	[AUDIT_CLI]      = "cli",
+};
+
+static AuditRecord ring[AUDIT_RING];
+static guint head = 0;		/* next slot to fill */
+static guint tail = 0;		/* oldest unflushed slot */
+static guint dropped = 0;
+static gboolean flush_now = FALSE;
+static gboolean closing = FALSE;
+static GMutex lock;
+static GCond cond;
+static GThread *flusher = NULL;
+
+static PendingWrite pending[N_PENDING];
+
+static const gchar *
+state_name (guint8 state)
+{
+	if (state & 2)
+		return "hard-blocked";
+	return (state & 1) ? "soft-blocked" : "unblocked";
+}
+
+static void
+format_record (GString *out, const AuditRecord *rec)
+{
+	gchar stamp[32];
+	time_t secs = rec->time / G_USEC_PER_SEC;
+	struct tm tm;
+
+	localtime_r (&secs, &tm);
+	strftime (stamp, sizeof (stamp), "%Y-%m-%d %H:%M:%S", &tm);
+
+	g_string_append_printf (out, "%s.%03d %-8s %-10s rfkill%u %s -> %s",
+				stamp, (gint) (rec->time % G_USEC_PER_SEC / 1000),
+				initiator_names[rec->initiator],
+				rfkill_type_name (rec->type), rec->idx,
+				state_name (rec->old_state), state_name (rec->new_state));
+	if (rec->error)
+		g_string_append_printf (out, " failed: %s\n", g_strerror (rec->error));
+	else if (rec->initiator != AUDIT_EXTERNAL)
+		g_string_append_printf (out, " %.1f ms\n", rec->latency_usec / 1000.0);
+	else
+		g_string_append_c (out, '\n');
+}
+
+static gpointer
+flush_thread (gpointer path)
+{
+	static AuditRecord batch[AUDIT_RING];
+	GString *out = g_string_sized_new (4096);
+	gboolean done;
+	guint lost;
+	guint n;
+	guint i;
+	gint fd;
+
+	g_mutex_lock (&lock);
+	for (;;) {
+		while (!closing && !flush_now && head - tail < FLUSH_BATCH)
+			g_cond_wait (&cond, &lock);
+
+		for (n = 0; tail != head; n++, tail++)
+			batch[n] = ring[tail % AUDIT_RING];
+		lost = dropped;
+		dropped = 0;
+		flush_now = FALSE;
+		done = closing;
+		g_mutex_unlock (&lock);
+
+		/* everything below runs without the lock */
+		g_string_truncate (out, 0);
+		if (lost)
+			g_string_append_printf (out, "%u records dropped, the ring was full\n", lost);
+		for (i = 0; i < n; i++)
+			format_record (out, &batch[i]);
+
+		if (out->len) {
+			fd = open (path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0600);
+			if (fd >= 0) {
+				if (write (fd, out->str, out->len) < 0)
+					g_printerr ("grfkill: audit log: %s\n", g_strerror (errno));
+				close (fd);
+			}
+		}
+
+		if (done)
+			break;
+		g_mutex_lock (&lock);
+	}
+
+	g_string_free (out, TRUE);
+	g_free (path);
+	return NULL;
+}
+
+static void
+push (const AuditRecord *rec)
+{
+	if (flusher == NULL)
+		return;
+
+	g_mutex_lock (&lock);
+	if (head - tail == AUDIT_RING) {
+		tail++;
+		dropped++;
+	}
+	ring[head++ % AUDIT_RING] = *rec;
+	if (head - tail >= FLUSH_BATCH)
+		g_cond_signal (&cond);
+	g_mutex_unlock (&lock);
+}
+
+static guint8
+pack_state (gboolean soft, gboolean hard)
+{
+	return (soft ? 1 : 0) | (hard ? 2 : 0);
+}
+
+void
+audit_open (void)
+{
+	gchar *dir;
+
+	dir = g_build_filename (g_get_user_data_dir (), "grfkill", NULL);
+	g_mkdir_with_parents (dir, 0700);
+	flusher = g_thread_new ("audit", flush_thread,
+				g_build_filename (dir, "audit.log", NULL));
+	g_free (dir);
+}
+
+/* the write still waiting for @idx's change event; stale ones are dropped */
+static PendingWrite *
+find_pending (guint32 idx, gint64 now)
+{
+	guint i;
+
+	for (i = 0; i < N_PENDING; i++)
+		if (pending[i].active && now - pending[i].issued > PENDING_USEC)
+			pending[i].active = FALSE;
+
+	for (i = 0; i < N_PENDING; i++)
+		if (pending[i].active && pending[i].idx == idx)
+			return &pending[i];
+
+	return NULL;
+}
+
+/* a write was issued (error == 0) or failed (error is an errno) */
+void
+audit_request (guint8              initiator,
+	       const RfkillDevice *dev,
+	       gboolean            blocked,
+	       gint                error)
+{
+	PendingWrite *p;
+	AuditRecord rec;
+	gint64 now = g_get_monotonic_time ();
+	guint i;
+
+	if (error) {
+		if ((p = find_pending (dev->idx, now)))
+			p->active = FALSE;
+
+		memset (&rec, 0, sizeof (rec));
+		rec.time = g_get_real_time ();
+		rec.idx = dev->idx;
+		rec.type = dev->type;
+		rec.initiator = initiator;
+		rec.error = error;
+		rec.old_state = pack_state (dev->soft, dev->hard);
+		rec.new_state = pack_state (blocked, dev->hard);
+		push (&rec);
+		return;
+	}
+
+	/* no change, so no event would ever match it */
+	if (blocked == dev->soft)
+		return;
+
+	/* the outcome is recorded when the kernel reports the change */
+	if ((p = find_pending (dev->idx, now)) == NULL) {
+		p = &pending[0];
+		for (i = 0; i < N_PENDING; i++) {
+			if (!pending[i].active) {
+				p = &pending[i];
+				break;
+			}
+			if (pending[i].issued < p->issued)
+				p = &pending[i];
+		}
+	}
+
+	p->active = TRUE;
+	p->idx = dev->idx;
+	p->initiator = initiator;
+	p->issued = now;
+}
+
+/* the kernel reported a change of @dev, which now holds the new state */
+void
+audit_change (const RfkillDevice *dev,
+	      gboolean            old_soft,
+	      gboolean            old_hard)
+{
+	PendingWrite *p;
+	AuditRecord rec;
+	gint64 now = g_get_monotonic_time ();
+
+	memset (&rec, 0, sizeof (rec));
+	rec.time = g_get_real_time ();
+	rec.idx = dev->idx;
+	rec.type = dev->type;
+	rec.initiator = AUDIT_EXTERNAL;
+	rec.old_state = pack_state (old_soft, old_hard);
+	rec.new_state = pack_state (dev->soft, dev->hard);
+
+	if ((p = find_pending (dev->idx, now))) {
+		rec.initiator = p->initiator;
+		rec.latency_usec = now - p->issued;
+		p->active = FALSE;
+	}
+
+	push (&rec);
+}
+
+/* ask the flusher to write what it has, without waiting for it */
+void
+audit_flush (void)
+{
+	if (flusher == NULL)
+		return;
+
+	g_mutex_lock (&lock);
+	flush_now = TRUE;
+	g_cond_signal (&cond);
+	g_mutex_unlock (&lock);
+}
+
+void
+audit_close (void)
+{
+	if (flusher == NULL)
+		return;
+
+	g_mutex_lock (&lock);
+	closing = TRUE;
+	g_cond_signal (&cond);
+	g_mutex_unlock (&lock);
+
+	g_thread_join (flusher);
+	flusher = NULL;
+}
@@ -1,474 +0,0 @@
-/* GdkPixbuf RGBA C-Source image dump 1-byte-run-length-encoded */
-
-static const GdkPixdata bt_unblocked_inline = {
-  0x47646b50, /* Pixbuf magic: 'GdkP' */
-  24 + 9789, /* header length + pixel_data length */
-  0x2010002, /* pixdata_type */
-  512, /* rowstride */
-  128, /* width */
-  128, /* height */
-  /* pixel_data: */
-  "\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\270\0\0"
-  "\0\0\11\325\325\325\6\310\310\310\27\310\310\310%\314\314\3142\316\316"
-  "\316\77\314\314\314K\314\314\314P\315\315\315V\315\315\315\\\202\314"
-  "\314\314d\204\315\315\315k\13\314\314\314d\313\313\313c\315\315\315\\"
-  "\315\315\315V\314\314\314P\317\317\317J\316\316\316>\313\313\3131\314"
-  "\314\314#\305\305\305\26\314\314\314\5\341\0\0\0\0\5\304\304\304\15\313"
-  "\313\313'\313\313\313@\316\316\316X\314\314\314j\232\314\314\314t\5\314"
-  "\314\314i\315\315\315V\315\315\315=\315\315\315$\314\314\314\12\330\0"
-  "\0\0\0\4\377\377\377\1\314\314\314\36\314\314\314A\316\316\316b\244\315"
-  "\315\315u\3\316\316\316^\315\315\315=\316\316\316\32\323\0\0\0\0\3\306"
-  "\306\306\22\314\314\314A\312\312\312j\227\313\313\313v\223\314\314\314"
-  "w\3\313\313\313g\314\314\314<\310\310\310\16\316\0\0\0\0\2\314\314\314"
-  "\36\314\314\314U\257\314\314\314x\3\313\313\313v\313\313\313O\310\310"
-  "\310\27\312\0\0\0\0\2\321\321\321\26\315\315\315W\227\314\314\314y\2"
-  "\314\314\3147\315\315\315u\233\314\314\314y\2\313\313\313O\317\317\317"
-  "\20\306\0\0\0\0\2\314\314\314\12\313\313\313N\231\315\315\315z\3\321"
-  "\321\321\13\311\311\311\23\315\315\315g\233\315\315\315z\3\314\314\314"
-  "x\317\317\317E\325\325\325\6\303\0\0\0\0\2\312\312\312\35\314\314\314"
-  "m\232\313\313\313{\4\277\277\277\14\0\0\0\0\314\314\314\12\312\312\312"
-  "\\\234\313\313\313{\2\313\313\313f\314\314\314\24\301\0\0\0\0\2\314\314"
-  "\3147\313\313\313z\233\314\314\314|\1\277\277\277\14\202\0\0\0\0\2\377"
-  "\377\377\2\311\311\311G\202\314\314\314|\232\314\314\314}\2\314\314\314"
-  "x\320\320\320+\276\0\0\0\0\2\377\377\377\2\313\313\313O\235\314\314\314"
-  "~\1\325\325\325\14\204\0\0\0\0\2\316\316\316*\314\314\314y\234\314\314"
-  "\314~\1\316\316\316\77\275\0\0\0\0\1\315\315\315L\236\315\315\315\177"
-  "\1\325\325\325\14\205\0\0\0\0\2\314\314\314\31\315\315\315p\234\315\315"
-  "\315\177\1\314\314\314<\273\0\0\0\0\1\311\311\311B\237\313\313\313\200"
-  "\1\325\325\325\14\206\0\0\0\0\2\271\271\271\13\312\312\312`\233\313\313"
-  "\313\200\2\315\315\315\177\313\313\3131\271\0\0\0\0\1\314\314\3142\240"
-  "\314\314\314\201\1\325\325\325\14\207\0\0\0\0\3\200\200\200\2\313\313"
-  "\313E\315\315\315\200\232\314\314\314\201\2\315\315\315\177\315\315\315"
-  "$\267\0\0\0\0\2\316\316\316\25\316\316\316|\240\314\314\314\202\1\325"
-  "\325\325\14\211\0\0\0\0\2\317\317\3170\315\315\315\177\232\314\314\314"
-  "\203\2\314\314\314w\277\277\277\14\265\0\0\0\0\2\252\252\252\3\315\315"
-  "\315k\241\315\315\315\204\1\325\325\325\14\212\0\0\0\0\2\316\316\316"
-  "\25\314\314\314o\232\315\315\315\204\1\316\316\316]\265\0\0\0\0\1\317"
-  "\317\317:\242\313\313\313\205\1\304\304\304\15\213\0\0\0\0\2\321\321"
-  "\321\13\311\311\311d\232\313\313\313\205\1\312\312\312+\263\0\0\0\0\2"
-  "\304\304\304\15\315\315\315\177\242\314\314\314\206\1\304\304\304\15"
-  "\214\0\0\0\0\3\0\0\0\1\312\312\312\77\315\315\315\205\230\314\314\314"
-  "\206\2\314\314\314w\314\314\314\5\262\0\0\0\0\1\313\313\313I\243\314"
-  "\314\314\207\1\304\304\304\15\216\0\0\0\0\2\313\313\3131\314\314\314"
-  "\202\230\314\314\314\207\1\313\313\313;\261\0\0\0\0\2\325\325\325\6\315"
-  "\315\315\177\243\314\314\314\210\1\304\304\304\15\204\0\0\0\0\2\316\316"
-  "\316\32\314\314\314\17\211\0\0\0\0\2\320\320\320\33\314\314\314y\227"
-  "\315\315\315\211\2\314\314\314w\200\200\200\2\260\0\0\0\0\2\317\317\317"
-  ":\315\315\315\211\243\313\313\313\212\1\304\304\304\15\204\0\0\0\0\3"
-  "\312\312\3120\313\313\313\200\317\317\317%\211\0\0\0\0\2\277\277\277"
-  "\10\312\312\312`\227\313\313\313\212\1\313\313\313,\257\0\0\0\0\2\377"
-  "\377\377\1\314\314\314w\244\314\314\314\213\1\304\304\304\15\204\0\0"
-  "\0\0\5\312\312\3120\314\314\314\213\315\315\315\211\314\314\314A\0\0"
-  "\0\1\210\0\0\0\0\3\0\0\0\1\314\314\314A\315\315\315\212\225\314\314\314"
-  "\213\1\314\314\314i\257\0\0\0\0\1\315\315\315$\245\314\314\314\214\1"
-  "\330\330\330\15\204\0\0\0\0\1\317\317\3170\203\314\314\314\214\2\315"
-  "\315\315V\277\277\277\4\211\0\0\0\0\2\315\315\3153\314\314\314\207\225"
-  "\314\314\314\214\1\310\310\310\27\256\0\0\0\0\1\313\313\313S\245\314"
-  "\314\314\215\1\330\330\330\15\204\0\0\0\0\1\313\313\3131\204\314\314"
-  "\314\215\2\314\314\314s\325\325\325\22\211\0\0\0\0\2\321\321\321\26\314"
-  "\314\314w\224\314\314\314\215\1\313\313\313E\255\0\0\0\0\2\0\0\0\1\314"
-  "\314\314~\245\315\315\315\216\1\330\330\330\15\204\0\0\0\0\1\313\313"
-  "\3131\205\315\315\315\216\2\316\316\316\203\311\311\311&\211\0\0\0\0"
-  "\2\277\277\277\10\313\313\313c\223\313\313\313\217\1\313\313\313q\255"
-  "\0\0\0\0\1\306\306\306\33\205\313\313\313\217\241\314\314\314\220\1\310"
-  "\310\310\16\204\0\0\0\0\1\314\314\3142\206\314\314\314\220\2\315\315"
-  "\315\216\316\316\316C\211\0\0\0\0\3\0\0\0\1\316\316\316C\313\313\313"
-  "\217\221\314\314\314\220\2\315\315\315\217\317\317\317\20\254\0\0\0\0"
-  "\1\315\315\315G\246\314\314\314\221\1\310\310\310\16\204\0\0\0\0\1\314"
-  "\314\3142\210\314\314\314\221\2\316\316\316^\325\325\325\6\211\0\0\0"
-  "\0\2\313\313\313,\315\315\315\211\221\314\314\314\221\1\313\313\313;"
-  "\254\0\0\0\0\1\315\315\315k\246\314\314\314\222\1\310\310\310\16\204"
-  "\0\0\0\0\1\314\314\3142\211\314\314\314\222\2\315\315\315q\314\314\314"
-  "\17\211\0\0\0\0\2\312\312\312\35\315\315\315\200\220\314\314\314\222"
-  "\1\316\316\316^\253\0\0\0\0\2\0\0\0\1\315\315\315\212\246\315\315\315"
-  "\223\1\310\310\310\16\204\0\0\0\0\1\315\315\3153\212\315\315\315\223"
-  "\2\314\314\314\210\313\313\313'\211\0\0\0\0\2\277\277\277\10\315\315"
-  "\315e\217\315\315\315\223\1\314\314\314~\253\0\0\0\0\1\316\316\316\25"
-  "\247\313\313\313\224\1\310\310\310\16\204\0\0\0\0\1\315\315\3153\211"
-  "\313\313\313\224\202\314\314\314\225\2\313\313\313\223\314\314\314F\211"
-  "\0\0\0\0\3\0\0\0\1\314\314\314F\313\313\313\224\215\314\314\314\225\2"
-  "\315\315\315\224\306\306\306\11\252\0\0\0\0\1\315\315\3153\211\314\314"
-  "\314\225\236\314\314\314\226\1\310\310\310\16\204\0\0\0\0\1\311\311\311"
-  "4\215\314\314\314\226\2\315\315\315a\325\325\325\6\211\0\0\0\0\2\314"
-  "\314\314-\313\313\313\216\215\314\314\314\226\1\321\321\321'\252\0\0"
-  "\0\0\1\315\315\315Q\212\314\314\314\227\3\315\315\315k\315\315\3158\314"
-  "\314\314\222\232\314\314\314\227\1\310\310\310\16\204\0\0\0\0\1\316\316"
-  "\3164\216\314\314\314\227\2\314\314\314t\314\314\314\17\211\0\0\0\0\2"
-  "\314\314\314\36\313\313\313\205\214\314\314\314\227\1\317\317\317E\252"
-  "\0\0\0\0\1\314\314\314j\211\315\315\315\230\5\314\314\314~\333\333\333"
-  "\7\0\0\0\0\320\320\320\33\315\315\315\204\231\315\315\315\230\1\310\310"
-  "\310\16\204\0\0\0\0\1\316\316\3164\217\315\315\315\230\2\314\314\314"
-  "\214\321\321\321'\211\0\0\0\0\2\337\337\337\10\314\314\314i\213\315\315"
-  "\315\230\1\314\314\314_\252\0\0\0\0\1\314\314\314}\210\313\313\313\231"
-  "\2\313\313\313\222\316\316\316\32\203\0\0\0\0\2\330\330\330\15\312\312"
-  "\312t\230\313\313\313\231\1\310\310\310\16\204\0\0\0\0\1\312\312\312"
-  "5\220\313\313\313\231\2\314\314\314\225\313\313\313;\211\0\0\0\0\2\377"
-  "\377\377\2\312\312\312V\212\313\313\313\231\1\312\312\312s\252\0\0\0"
-  "\0\1\313\313\313\222\207\314\314\314\232\2\313\313\313\231\311\311\311"
-  "/\205\0\0\0\0\3\200\200\200\2\315\315\315R\315\315\315\231\226\314\314"
-  "\314\232\1\333\333\333\16\204\0\0\0\0\1\312\312\3125\214\314\314\314"
-  "\232\206\314\314\314\233\2\314\314\314d\314\314\314\5\211\0\0\0\0\2\311"
-  "\311\311/\314\314\314\222\210\314\314\314\233\1\315\315\315\211\251\0"
-  "\0\0\0\1\321\321\321\13\210\314\314\314\233\1\313\313\313N\210\0\0\0"
-  "\0\2\313\313\3136\314\314\314\226\225\314\314\314\234\1\314\314\314\17"
-  "\204\0\0\0\0\1\313\313\3136\223\314\314\314\234\2\314\314\314~\311\311"
-  "\311\23\211\0\0\0\0\2\325\325\325\30\313\313\313\204\207\314\314\314"
-  "\234\2\314\314\314\233\277\277\277\4\250\0\0\0\0\1\314\314\314\36\210"
-  "\315\315\315\235\1\313\313\313E\211\0\0\0\0\2\322\322\322\"\314\314\314"
-  "\215\224\315\315\315\235\1\314\314\314\17\204\0\0\0\0\1\313\313\3136"
-  "\224\315\315\315\235\1\314\314\314_\212\0\0\0\0\1\313\313\3136\210\315"
-  "\315\315\235\1\321\321\321\26\250\0\0\0\0\1\315\315\315.\211\313\313"
-  "\313\236\2\313\313\313c\314\314\314\5\210\0\0\0\0\2\314\314\314\17\313"
-  "\313\313z\223\313\313\313\236\1\314\314\314\17\204\0\0\0\0\1\307\307"
-  "\3077\222\313\313\313\236\3\315\315\315\235\315\315\315Q\377\377\377"
-  "\1\210\0\0\0\0\3\0\0\0\1\312\312\312H\313\313\313\234\210\313\313\313"
-  "\236\1\313\313\313'\250\0\0\0\0\1\313\313\313;\212\314\314\314\237\2"
-  "\314\314\314\202\302\302\302\25\210\0\0\0\0\2\377\377\377\2\314\314\314"
-  "U\222\314\314\314\237\1\314\314\314\17\204\0\0\0\0\1\314\314\3147\221"
-  "\314\314\314\237\2\315\315\315\224\314\314\314-\211\0\0\0\0\2\271\271"
-  "\271\13\315\315\315p\212\314\314\314\237\1\311\311\3114\250\0\0\0\0\1"
-  "\315\315\315G\213\314\314\314\240\2\313\313\313\222\311\311\311&\211"
-  "\0\0\0\0\2\314\314\314A\314\314\314\234\220\314\314\314\240\1\314\314"
-  "\314\17\204\0\0\0\0\1\314\314\3147\216\314\314\314\240\202\314\314\314"
-  "\241\2\315\315\315\211\306\306\306\33\211\0\0\0\0\2\314\314\314\31\316"
-  "\316\316\206\213\314\314\314\241\1\317\317\317@\250\0\0\0\0\1\316\316"
-  "\316S\214\314\314\314\241\2\314\314\314\237\315\315\315L\211\0\0\0\0"
-  "\2\316\316\316\37\315\315\315\216\217\315\315\315\242\1\314\314\314\17"
-  "\204\0\0\0\0\1\315\315\3158\217\315\315\315\242\2\315\315\315l\277\277"
-  "\277\10\211\0\0\0\0\2\317\317\3175\315\315\315\232\214\315\315\315\242"
-  "\1\313\313\313N\250\0\0\0\0\1\312\312\312a\216\313\313\313\243\2\314"
-  "\314\314j\325\325\325\6\210\0\0\0\0\2\304\304\304\15\314\314\314y\216"
-  "\313\313\313\243\1\314\314\314\17\204\0\0\0\0\1\315\315\3158\215\313"
-  "\313\313\243\3\313\313\313\241\315\315\315L\377\377\377\1\210\0\0\0\0"
-  "\3\377\377\377\1\312\312\312W\313\313\313\242\215\313\313\313\243\1\314"
-  "\314\314Z\250\0\0\0\0\1\315\315\315k\217\314\314\314\244\2\315\315\315"
-  "\177\317\317\317\20\210\0\0\0\0\2\314\314\314\5\313\313\313g\215\314"
-  "\314\314\244\1\314\314\314\17\204\0\0\0\0\1\311\311\3119\214\314\314"
-  "\314\244\2\314\314\314\233\315\315\3153\211\0\0\0\0\2\277\277\277\10"
-  "\312\312\312o\217\314\314\314\244\1\313\313\313f\250\0\0\0\0\1\314\314"
-  "\314s\220\314\314\314\245\2\315\315\315\230\320\320\320+\211\0\0\0\0"
-  "\2\315\315\315B\314\314\314\241\213\314\314\314\245\1\277\277\277\20"
-  "\204\0\0\0\0\1\316\316\3169\213\314\314\314\245\2\314\314\314\210\310"
-  "\310\310\27\211\0\0\0\0\2\310\310\310\34\313\313\313\216\220\314\314"
-  "\314\245\1\314\314\314m\250\0\0\0\0\1\315\315\315z\221\314\314\314\246"
-  "\2\315\315\315\243\315\315\315M\211\0\0\0\0\2\311\311\311&\314\314\314"
-  "\226\212\314\314\314\246\1\317\317\317\20\204\0\0\0\0\1\316\316\3169"
-  "\212\314\314\314\246\2\314\314\314o\277\277\277\10\211\0\0\0\0\2\313"
-  "\313\3136\315\315\315\237\221\315\315\315\247\1\315\315\315u\250\0\0"
-  "\0\0\1\315\315\315\200\217\315\315\315\247\204\313\313\313\250\2\313"
-  "\313\313l\325\325\325\6\210\0\0\0\0\2\322\322\322\21\314\314\314\203"
-  "\211\313\313\313\250\1\317\317\317\20\204\0\0\0\0\1\312\312\312:\210"
-  "\313\313\313\250\3\313\313\313\246\316\316\316N\377\377\377\1\210\0\0"
-  "\0\0\3\377\377\377\1\311\311\311Z\313\313\313\247\222\313\313\313\250"
-  "\1\314\314\314|\250\0\0\0\0\1\313\313\313\211\224\314\314\314\251\2\314"
-  "\314\314\210\302\302\302\25\210\0\0\0\0\2\314\314\314\5\315\315\315g"
-  "\210\314\314\314\251\1\317\317\317\20\204\0\0\0\0\1\317\317\317:\207"
-  "\314\314\314\251\2\313\313\313\235\316\316\316/\211\0\0\0\0\2\314\314"
-  "\314\12\314\314\314w\224\314\314\314\251\1\314\314\314\203\250\0\0\0"
-  "\0\1\315\315\315\217\225\314\314\314\252\2\314\314\314\234\312\312\312"
-  "+\211\0\0\0\0\2\313\313\313D\313\313\313\247\206\314\314\314\252\1\317"
-  "\317\317\20\204\0\0\0\0\1\313\313\313;\206\314\314\314\252\2\314\314"
-  "\314\210\314\314\314\24\211\0\0\0\0\2\320\320\320\33\314\314\314\221"
-  "\225\314\314\314\252\1\314\314\314\213\250\0\0\0\0\1\313\313\313\224"
-  "\226\314\314\314\253\2\314\314\314\246\313\313\313@\211\0\0\0\0\2\316"
-  "\316\316/\314\314\314\237\205\314\314\314\253\1\317\317\317\20\204\0"
-  "\0\0\0\1\313\313\313;\205\314\314\314\253\2\315\315\315v\343\343\343"
-  "\11\211\0\0\0\0\2\314\314\314-\315\315\315\236\226\314\314\314\253\1"
-  "\314\314\314\220\250\0\0\0\0\1\314\314\314\226\230\315\315\315\254\2"
-  "\315\315\315g\277\277\277\4\210\0\0\0\0\2\311\311\311\23\314\314\314"
-  "\210\204\315\315\315\254\1\317\317\317\20\204\0\0\0\0\1\317\317\317;"
-  "\203\315\315\315\254\2\315\315\315\251\313\313\313E\211\0\0\0\0\4\377"
-  "\377\377\1\315\315\315\\\314\314\314\253\315\315\315\254\226\313\313"
-  "\313\255\1\313\313\313\223\250\0\0\0\0\1\313\313\313\230\222\313\313"
-  "\313\255\207\314\314\314\256\2\314\314\314\206\322\322\322\21\210\0\0"
-  "\0\0\2\314\314\314\5\315\315\315l\203\314\314\314\256\1\317\317\317\20"
-  "\204\0\0\0\0\1\314\314\314<\202\314\314\314\256\2\314\314\314\237\312"
-  "\312\312+\211\0\0\0\0\2\314\314\314\12\314\314\314y\231\314\314\314\256"
-  "\1\314\314\314\225\250\0\0\0\0\1\315\315\315\232\232\314\314\314\257"
-  "\2\315\315\315\235\320\320\320&\211\0\0\0\0\4\314\314\314F\313\313\313"
-  "\254\314\314\314\257\317\317\317\20\204\0\0\0\0\4\314\314\314<\314\314"
-  "\314\257\314\314\314\213\314\314\314\24\211\0\0\0\0\2\320\320\320\33"
-  "\315\315\315\224\232\314\314\314\257\1\313\313\313\230\250\0\0\0\0\1"
-  "\315\315\315\235\233\314\314\314\260\2\314\314\314\253\313\313\313E\211"
-  "\0\0\0\0\3\312\312\312+\314\314\314\241\303\303\303\21\204\0\0\0\0\3"
-  "\315\315\315=\314\314\314n\252\252\252\6\211\0\0\0\0\2\317\317\3170\314"
-  "\314\314\244\233\314\314\314\260\1\314\314\314\232\250\0\0\0\0\1\315"
-  "\315\315\237\235\315\315\315\261\2\315\315\315a\377\377\377\2\210\0\0"
-  "\0\0\2\316\316\316\32\306\306\306\11\204\0\0\0\0\2\310\310\310\16\377"
-  "\377\377\1\211\0\0\0\0\2\314\314\314K\314\314\314\256\234\315\315\315"
-  "\261\1\314\314\314\234\250\0\0\0\0\1\313\313\313\241\236\313\313\313"
-  "\262\2\313\313\313\211\303\303\303\21\226\0\0\0\0\2\277\277\277\10\315"
-  "\315\315u\212\313\313\313\262\224\314\314\314\263\1\314\314\314\237\250"
-  "\0\0\0\0\1\313\313\313\243\224\314\314\314\263\213\314\314\314\264\2"
-  "\314\314\314\241\311\311\311&\224\0\0\0\0\2\323\323\323\27\313\313\313"
-  "\223\237\314\314\314\264\1\313\313\313\242\250\0\0\0\0\1\314\314\314"
-  "\246\240\314\314\314\265\2\314\314\314\260\313\313\313E\222\0\0\0\0\2"
-  "\317\317\3170\313\313\313\250\240\314\314\314\265\1\314\314\314\244\250"
-  "\0\0\0\0\1\315\315\315\250\242\315\315\315\266\2\316\316\316m\277\277"
-  "\277\4\217\0\0\0\0\2\314\314\314U\314\314\314\264\241\315\315\315\266"
-  "\1\314\314\314\246\250\0\0\0\0\1\314\314\314\252\243\313\313\313\267"
-  "\2\314\314\314\213\303\303\303\21\214\0\0\0\0\2\333\333\333\7\314\314"
-  "\314w\243\313\313\313\267\1\314\314\314\251\250\0\0\0\0\1\315\315\315"
-  "\254\244\314\314\314\270\2\314\314\314\244\320\320\320&\212\0\0\0\0\2"
-  "\310\310\310\27\314\314\314\225\222\314\314\314\270\222\314\314\314\271"
-  "\1\313\313\313\255\250\0\0\0\0\1\315\315\315\255\225\314\314\314\271"
-  "\217\314\314\314\272\2\314\314\314\246\321\321\321'\212\0\0\0\0\2\314"
-  "\314\314\31\315\315\315\230\244\314\314\314\272\1\314\314\314\256\250"
-  "\0\0\0\0\1\314\314\314\256\243\315\315\315\273\2\314\314\314\210\310"
-  "\310\310\16\214\0\0\0\0\2\314\314\314\5\314\314\314s\243\315\315\315"
-  "\273\1\315\315\315\255\250\0\0\0\0\1\313\313\313\255\242\313\313\313"
-  "\274\2\314\314\314d\377\377\377\2\217\0\0\0\0\2\314\314\314K\314\314"
-  "\314\270\241\313\313\313\274\1\313\313\313\255\250\0\0\0\0\1\315\315"
-  "\315\255\240\314\314\314\275\2\313\313\313\266\314\314\314A\222\0\0\0"
-  "\0\2\321\321\321,\313\313\313\254\240\314\314\314\275\1\313\313\313\254"
-  "\250\0\0\0\0\1\313\313\313\255\237\314\314\314\276\2\314\314\314\245"
-  "\315\315\315$\224\0\0\0\0\2\316\316\316\25\314\314\314\226\217\314\314"
-  "\314\276\220\314\314\314\277\1\315\315\315\254\250\0\0\0\0\1\315\315"
-  "\315\254\230\314\314\314\277\206\315\315\315\300\2\314\314\314\215\310"
-  "\310\310\16\226\0\0\0\0\2\314\314\314\5\314\314\314w\236\315\315\315"
-  "\300\1\315\315\315\254\250\0\0\0\0\1\313\313\313\255\235\313\313\313"
-  "\301\2\312\312\312t\314\314\314\5\210\0\0\0\0\2\312\312\312\35\314\314"
-  "\314\12\204\0\0\0\0\2\314\314\314\17\377\377\377\1\210\0\0\0\0\3\377"
-  "\377\377\1\312\312\312[\313\313\313\277\234\313\313\313\301\1\313\313"
-  "\313\254\250\0\0\0\0\1\313\313\313\255\233\314\314\314\302\2\314\314"
-  "\314\272\313\313\313D\211\0\0\0\0\3\313\313\313@\314\314\314\271\325"
-  "\325\325\22\204\0\0\0\0\3\312\312\312C\314\314\314\213\304\304\304\15"
-  "\211\0\0\0\0\2\315\315\315.\313\313\313\261\233\314\314\314\302\1\314"
-  "\314\314\253\250\0\0\0\0\1\315\315\315\254\232\314\314\314\303\2\313"
-  "\313\313\253\310\310\310%\210\0\0\0\0\5\200\200\200\2\314\314\314h\314"
-  "\314\314\302\314\314\314\303\325\325\325\22\204\0\0\0\0\4\316\316\316"
-  "C\314\314\314\303\315\315\315\250\322\322\322\"\211\0\0\0\0\2\316\316"
-  "\316\25\315\315\315\232\232\314\314\314\303\1\313\313\313\253\250\0\0"
-  "\0\0\1\315\315\315\254\231\314\314\314\304\2\314\314\314\221\314\314"
-  "\314\17\210\0\0\0\0\2\325\325\325\14\314\314\314\214\203\314\314\314"
-  "\304\1\325\325\325\22\204\0\0\0\0\1\313\313\313D\202\314\314\314\304"
-  "\2\315\315\315\273\314\314\314A\211\0\0\0\0\2\325\325\325\6\315\315\315"
-  "z\213\314\314\314\304\216\315\315\315\305\1\314\314\314\253\250\0\0\0"
-  "\0\1\315\315\315\254\230\315\315\315\305\2\314\314\314i\252\252\252\3"
-  "\210\0\0\0\0\2\311\311\311!\314\314\314\251\204\313\313\313\306\1\311"
-  "\311\311\23\204\0\0\0\0\1\316\316\316D\203\313\313\313\306\3\313\313"
-  "\313\305\312\312\312j\377\377\377\2\211\0\0\0\0\2\313\313\313O\314\314"
-  "\314\302\227\313\313\313\306\1\314\314\314\252\250\0\0\0\0\1\313\313"
-  "\313\254\226\314\314\314\307\2\314\314\314\302\312\312\312R\211\0\0\0"
-  "\0\2\313\313\3136\314\314\314\271\205\314\314\314\307\1\311\311\311\23"
-  "\204\0\0\0\0\1\313\313\313E\205\314\314\314\307\2\315\315\315\211\321"
-  "\321\321\13\211\0\0\0\0\2\316\316\3169\313\313\313\273\226\314\314\314"
-  "\307\1\314\314\314\251\250\0\0\0\0\1\313\313\313\250\225\314\314\314"
-  "\310\2\314\314\314\260\320\320\320&\210\0\0\0\0\3\200\200\200\2\313\313"
-  "\313k\314\314\314\307\206\314\314\314\310\1\311\311\311\23\204\0\0\0"
-  "\0\1\313\313\313E\206\314\314\314\310\2\313\313\313\255\314\314\314#"
-  "\211\0\0\0\0\2\321\321\321\26\315\315\315\236\225\314\314\314\310\1\314"
-  "\314\314\245\250\0\0\0\0\1\313\313\313\242\224\314\314\314\311\2\314"
-  "\314\314\226\317\317\317\20\210\0\0\0\0\2\277\277\277\14\314\314\314"
-  "\215\210\314\314\314\311\1\311\311\311\23\204\0\0\0\0\1\317\317\317E"
-  "\207\314\314\314\311\2\314\314\314\303\313\313\313J\211\0\0\0\0\2\325"
-  "\325\325\6\314\314\314}\224\314\314\314\311\1\315\315\315\236\250\0\0"
-  "\0\0\1\315\315\315\232\223\315\315\315\312\2\313\313\313l\377\377\377"
-  "\3\210\0\0\0\0\2\307\307\307\40\314\314\314\253\211\315\315\315\312\1"
-  "\311\311\311\23\204\0\0\0\0\1\314\314\314F\211\315\315\315\312\2\314"
-  "\314\314y\377\377\377\3\211\0\0\0\0\2\315\315\315Q\315\315\315\306\206"
-  "\315\315\315\312\214\313\313\313\313\1\313\313\313\231\250\0\0\0\0\1"
-  "\313\313\313\224\221\313\313\313\313\2\313\313\313\304\313\313\313I\211"
-  "\0\0\0\0\2\316\316\316>\313\313\313\301\212\314\314\314\314\1\311\311"
-  "\311\23\204\0\0\0\0\1\314\314\314F\212\314\314\314\314\2\313\313\313"
-  "\231\306\306\306\22\211\0\0\0\0\2\314\314\3142\314\314\314\272\221\314"
-  "\314\314\314\1\313\313\313\222\250\0\0\0\0\1\315\315\315\216\220\314"
-  "\314\314\315\2\314\314\314\265\314\314\314(\210\0\0\0\0\3\377\377\377"
-  "\1\315\315\315`\313\313\313\313\213\314\314\314\315\1\311\311\311\23"
-  "\204\0\0\0\0\1\315\315\315G\213\314\314\314\315\2\313\313\313\266\315"
-  "\315\315)\211\0\0\0\0\2\323\323\323\27\315\315\315\243\220\314\314\314"
-  "\315\1\314\314\314\213\223\0\0\0\0\1\0\200\0\"\224\0\0\0\0\1\314\314"
-  "\314\207\217\314\314\314\316\2\314\314\314\244\323\323\323\27\210\0\0"
-  "\0\0\2\325\325\325\6\315\315\315\200\215\314\314\314\316\1\327\327\327"
-  "\23\204\0\0\0\0\1\315\315\315G\214\314\314\314\316\2\314\314\314\303"
-  "\313\313\313@\211\0\0\0\0\2\271\271\271\13\314\314\314\215\217\314\314"
-  "\314\316\1\313\313\313\204\222\0\0\0\0\2\0\200\0""6\0\202\0""9\224\0"
-  "\0\0\0\1\314\314\314y\216\314\314\314\317\2\316\316\316n\377\377\377"
-  "\3\210\0\0\0\0\2\306\306\306\33\314\314\314\252\216\314\314\314\317\1"
-  "\327\327\327\23\204\0\0\0\0\1\315\315\315G\216\314\314\314\317\2\316"
-  "\316\316|\377\377\377\3\211\0\0\0\0\2\313\313\313S\315\315\315\313\215"
-  "\314\314\314\317\1\313\313\313v\221\0\0\0\0\2\0\200\0\26\0\200\0\243"
-  "\225\0\0\0\0\1\314\314\314j\214\314\314\314\320\2\314\314\314\311\315"
-  "\315\315L\211\0\0\0\0\2\314\314\3147\313\313\313\301\217\314\314\314"
-  "\320\1\314\314\314\24\204\0\0\0\0\1\312\312\312H\217\314\314\314\320"
-  "\2\313\313\313\235\306\306\306\22\211\0\0\0\0\2\315\315\3153\314\314"
-  "\314\276\202\314\314\314\320\212\314\314\314\321\1\314\314\314h\220\0"
-  "\0\0\0\3\0\200\0\4\0\200\0\276\0\200\0@\225\0\0\0\0\1\312\312\312\\\213"
-  "\314\314\314\321\2\313\313\313\300\316\316\3164\211\0\0\0\0\2\313\313"
-  "\313T\314\314\314\314\206\314\314\314\321\212\314\314\314\322\1\314\314"
-  "\314\24\204\0\0\0\0\1\315\315\315H\220\314\314\314\322\2\314\314\314"
-  "\263\314\314\314#\211\0\0\0\0\2\317\317\317\40\314\314\314\257\213\314"
-  "\314\314\322\1\314\314\314Z\220\0\0\0\0\2\0\200\0\214\0\200\0\300\226"
-  "\0\0\0\0\1\315\315\315M\212\314\314\314\323\2\314\314\314\244\305\305"
-  "\305\26\210\0\0\0\0\2\337\337\337\10\315\315\315\211\222\314\314\314"
-  "\323\1\314\314\314\24\204\0\0\0\0\1\313\313\313I\221\314\314\314\323"
-  "\2\315\315\315\314\313\313\313O\211\0\0\0\0\2\266\266\266\7\314\314\314"
-  "\202\212\314\314\314\323\1\317\317\317J\217\0\0\0\0\3\0\201\0W\0\200"
-  "\0\377\0\201\0A\226\0\0\0\0\1\316\316\316>\211\314\314\314\324\2\314"
-  "\314\314\210\333\333\333\7\210\0\0\0\0\2\314\314\314\24\315\315\315\243"
-  "\223\314\314\314\324\1\314\314\314\24\204\0\0\0\0\1\316\316\316I\222"
-  "\314\314\314\324\3\314\314\314\323\314\314\314m\200\200\200\2\210\0\0"
-  "\0\0\3\377\377\377\1\315\315\315`\314\314\314\321\210\314\314\314\324"
-  "\1\314\314\314<\216\0\0\0\0\3\0\200\0,\0\200\0\364\0\200\0\300\227\0"
-  "\0\0\0\1\315\315\315)\210\314\314\314\325\2\314\314\314\260\200\200\200"
-  "\2\210\0\0\0\0\2\314\314\314-\314\314\314\276\224\314\314\314\325\1\314"
-  "\314\314\24\204\0\0\0\0\1\313\313\313J\224\314\314\314\325\1\314\314"
-  "\314\201\212\0\0\0\0\1\313\313\313I\210\314\314\314\325\1\320\320\320"
-  "&\215\0\0\0\0\4\0\200\0\20\0\200\0\333\0\200\0\377\0\201\0A\227\0\0\0"
-  "\0\1\330\330\330\15\211\314\314\314\326\1\313\313\313p\207\0\0\0\0\2"
-  "\314\314\314d\313\313\313\323\225\314\314\314\326\1\314\314\314\24\204"
-  "\0\0\0\0\1\313\313\313J\223\314\314\314\326\2\314\314\314\234\317\317"
-  "\317\20\211\0\0\0\0\2\312\312\3120\313\313\313\301\210\314\314\314\327"
-  "\1\321\321\321\13\214\0\0\0\0\4\0\200\0\2\0\200\0\263\0\200\0\377\0\200"
-  "\0\300\231\0\0\0\0\1\313\313\313\312\210\314\314\314\327\2\314\314\314"
-  "\326\313\313\313I\204\0\0\0\0\2\277\277\277\10\313\313\313\211\217\314"
-  "\314\314\327\210\314\314\314\330\1\314\314\314\24\204\0\0\0\0\1\314\314"
-  "\314K\222\314\314\314\330\2\314\314\314s\252\252\252\3\211\0\0\0\0\2"
-  "\315\315\315V\314\314\314\323\210\314\314\314\330\1\314\314\314\307\215"
-  "\0\0\0\0\1\0\201\0\177\202\0\200\0\377\1\0\200\0B\231\0\0\0\0\1\315\315"
-  "\315\261\211\314\314\314\331\2\315\315\315\314\317\317\317\40\202\0\0"
-  "\0\0\2\306\306\306\22\313\313\313\243\230\314\314\314\331\1\314\314\314"
-  "\24\204\0\0\0\0\1\314\314\314K\220\314\314\314\331\2\314\314\314\323"
-  "\316\316\316T\211\0\0\0\0\2\377\377\377\3\315\315\315z\212\314\314\314"
-  "\331\1\315\315\315\255\214\0\0\0\0\4\0\201\0K\0\200\0\375\0\200\0\377"
-  "\0\200\0\300\232\0\0\0\0\1\312\312\312\226\212\314\314\314\332\4\314"
-  "\314\314\272\310\310\310\16\312\312\3120\313\313\313\304\231\314\314"
-  "\314\332\1\302\302\302\25\204\0\0\0\0\1\314\314\314K\217\314\314\314"
-  "\332\2\313\313\313\276\314\314\314(\211\0\0\0\0\2\316\316\316\25\313"
-  "\313\313\250\213\314\314\314\332\1\314\314\314\220\213\0\0\0\0\2\0\200"
-  "\0$\0\200\0\357\202\0\200\0\377\1\0\200\0B\232\0\0\0\0\1\313\313\313"
-  "u\213\314\314\314\333\2\313\313\313\254\314\314\314\322\232\314\314\314"
-  "\333\1\302\302\302\25\204\0\0\0\0\1\311\311\311L\216\314\314\314\333"
-  "\2\315\315\315\250\316\316\316\25\211\0\0\0\0\2\316\316\316*\315\315"
-  "\315\300\214\314\314\314\333\1\313\313\313p\212\0\0\0\0\2\0\213\0\13"
-  "\0\200\0\322\202\0\200\0\377\1\0\200\0\301\233\0\0\0\0\1\315\315\315"
-  "H\247\314\314\314\334\1\316\316\316\25\204\0\0\0\0\1\315\315\315L\215"
-  "\314\314\314\334\2\315\315\315u\252\252\252\3\211\0\0\0\0\2\315\315\315"
-  "V\314\314\314\326\210\314\314\314\334\205\314\314\314\335\1\313\313\313"
-  "D\212\0\0\0\0\1\0\200\0\247\203\0\200\0\377\1\0\201\0C\233\0\0\0\0\1"
-  "\310\310\310\34\241\314\314\314\335\206\314\314\314\336\1\316\316\316"
-  "\25\204\0\0\0\0\1\312\312\312M\213\314\314\314\336\2\315\315\315\325"
-  "\315\315\315M\211\0\0\0\0\2\314\314\314\5\315\315\315\205\217\314\314"
-  "\314\336\1\312\312\312\30\211\0\0\0\0\1\0\201\0q\203\0\200\0\377\1\0"
-  "\200\0\301\235\0\0\0\0\1\314\314\314\316\246\314\314\314\337\1\316\316"
-  "\316\25\204\0\0\0\0\1\312\312\312M\212\314\314\314\337\2\314\314\314"
-  "\303\316\316\316*\211\0\0\0\0\2\316\316\316\25\314\314\314\253\217\314"
-  "\314\314\337\1\314\314\314\311\211\0\0\0\0\2\0\200\0@\0\200\0\373\203"
-  "\0\200\0\377\1\0\200\0D\235\0\0\0\0\1\314\314\314\244\246\314\314\314"
-  "\340\1\316\316\316\25\204\0\0\0\0\1\315\315\315M\211\314\314\314\340"
-  "\2\314\314\314\256\310\310\310\27\211\0\0\0\0\2\315\315\315)\314\314"
-  "\314\303\220\314\314\314\340\1\314\314\314\240\210\0\0\0\0\2\0\200\0"
-  "\34\0\200\0\351\203\0\200\0\377\1\0\200\0\301\236\0\0\0\0\1\314\314\314"
-  "i\246\314\314\314\341\1\316\316\316\25\204\0\0\0\0\1\313\313\313N\210"
-  "\314\314\314\341\2\314\314\314x\277\277\277\4\211\0\0\0\0\2\315\315\315"
-  "W\314\314\314\333\221\314\314\314\341\1\312\312\312e\207\0\0\0\0\2\0"
-  "\222\0\7\0\200\0\310\204\0\200\0\377\1\0\200\0D\236\0\0\0\0\1\317\317"
-  "\317%\246\314\314\314\342\1\316\316\316\25\204\0\0\0\0\1\313\313\313"
-  "N\206\314\314\314\342\2\314\314\314\331\315\315\315Q\211\0\0\0\0\2\377"
-  "\377\377\4\314\314\314\210\221\314\314\314\342\202\314\314\314\343\1"
-  "\316\316\316\37\207\0\0\0\0\1\0\200\0\230\204\0\200\0\377\1\0\200\0\302"
-  "\240\0\0\0\0\1\314\314\314\303\241\314\314\314\343\204\314\314\314\344"
-  "\1\316\316\316\25\204\0\0\0\0\1\313\313\313O\205\314\314\314\344\2\314"
-  "\314\314\310\313\313\313,\211\0\0\0\0\2\316\316\316\25\314\314\314\256"
-  "\223\314\314\314\344\1\313\313\313\301\207\0\0\0\0\1\0\200\0d\205\0\200"
-  "\0\377\1\0\201\0E\240\0\0\0\0\1\314\314\314\201\245\314\314\314\345\1"
-  "\305\305\305\26\204\0\0\0\0\1\313\313\313O\204\314\314\314\345\2\314"
-  "\314\314\252\306\306\306\22\211\0\0\0\0\2\317\317\3170\314\314\314\315"
-  "\224\314\314\314\345\1\314\314\314}\206\0\0\0\0\2\0\202\0""5\0\200\0"
-  "\370\204\0\200\0\377\1\0\200\0\302\241\0\0\0\0\1\314\314\314<\245\314"
-  "\314\314\346\1\305\305\305\26\204\0\0\0\0\1\313\313\313O\203\314\314"
-  "\314\346\2\313\313\313\216\325\325\325\6\211\0\0\0\0\2\313\313\313N\314"
-  "\314\314\334\225\314\314\314\346\1\314\314\3147\205\0\0\0\0\2\0\206\0"
-  "\25\0\200\0\342\205\0\200\0\377\1\0\201\0E\242\0\0\0\0\1\315\315\315"
-  "\275\244\314\314\314\347\1\305\305\305\26\204\0\0\0\0\4\314\314\314P"
-  "\314\314\314\347\314\314\314\337\316\316\316S\211\0\0\0\0\2\314\314\314"
-  "\5\314\314\314\213\226\314\314\314\347\1\314\314\314\271\205\0\0\0\0"
-  "\2\0\200\0\4\0\200\0\276\205\0\200\0\377\1\0\200\0\302\243\0\0\0\0\1"
-  "\315\315\315\\\244\314\314\314\350\1\321\321\321\26\204\0\0\0\0\3\314"
-  "\314\314P\314\314\314\314\314\314\314-\211\0\0\0\0\3\316\316\316\25\315"
-  "\315\315\261\307\312\307\351\226\314\314\314\350\1\313\313\313Y\205\0"
-  "\0\0\0\1\0\200\0\203\206\0\200\0\377\1\0\200\0J\243\0\0\0\0\2\314\314"
-  "\314\12\314\314\314\331\241\314\314\314\351\202\314\314\314\352\1\321"
-  "\321\321\26\204\0\0\0\0\2\314\314\314-\316\316\316\32\211\0\0\0\0\6\314"
-  "\314\314(\314\314\314\311\314\314\314\352\234\272\234\357b\245b\364\300"
-  "\310\300\353\223\314\314\314\352\2\314\314\314\331\306\306\306\11\204"
-  "\0\0\0\0\2\0\200\0V\0\200\0\376\205\0\200\0\377\1\0\200\0\302\245\0\0"
-  "\0\0\1\315\315\315\177\243\314\314\314\353\1\321\321\321\26\216\0\0\0"
-  "\0\2\315\315\315L\314\314\314\340\203\314\314\314\353\4\221\266\221\360"
-  "\25\210\25\375i\247i\364\305\311\305\354\221\314\314\314\353\1\314\314"
-  "\314}\204\0\0\0\0\2\0\200\0,\0\200\0\363\206\0\200\0\377\1\0\200\0F\245"
-  "\0\0\0\0\2\314\314\314\17\314\314\314\331\242\314\314\314\354\1\321\321"
-  "\321\26\214\0\0\0\0\2\314\314\314\5\313\313\313\216\206\314\314\314\354"
-  "\5\221\266\221\361\6\203\6\376\25\207\25\375v\253v\364\311\313\311\354"
-  "\216\314\314\314\354\2\314\314\314\326\325\325\325\14\203\0\0\0\0\2\0"
-  "\200\0\20\0\200\0\332\206\0\200\0\377\1\0\200\0\303\247\0\0\0\0\1\314"
-  "\314\314h\242\314\314\314\355\1\321\321\321\26\213\0\0\0\0\2\314\314"
-  "\314\17\315\315\315\250\210\314\314\314\355\6\217\265\217\362\6\203\6"
-  "\376\0\200\0\377\36\214\36\374\205\262\205\363\313\314\313\355\214\314"
-  "\314\314\355\1\316\316\316c\203\0\0\0\0\2\0\200\0\2\0\200\0\262\207\0"
-  "\200\0\377\1\0\201\0G\247\0\0\0\0\2\200\200\200\2\314\314\314\265\241"
-  "\314\314\314\356\1\321\321\321\26\212\0\0\0\0\2\313\313\3131\313\313"
-  "\313\323\212\314\314\314\356\2\217\264\217\363\5\201\5\377\202\0\200"
-  "\0\377\2\"\215\"\374\205\262\205\364\212\314\314\314\356\2\313\313\313"
-  "\257\377\377\377\1\203\0\0\0\0\1\0\200\0|\207\0\200\0\377\1\0\200\0\303"
-  "\251\0\0\0\0\2\313\313\313'\314\314\314\345\240\314\314\314\357\1\310"
-  "\310\310\27\211\0\0\0\0\2\315\315\315L\314\314\314\344\214\314\314\314"
-  "\360\2\217\266\217\364\5\201\5\377\203\0\200\0\377\2-\221-\374\226\270"
-  "\226\364\207\314\314\314\360\2\314\314\314\345\310\310\310%\203\0\0\0"
-  "\0\2\0\200\0J\0\200\0\375\207\0\200\0\377\1\0\201\0G\252\0\0\0\0\2\314"
-  "\314\314K\314\314\314\360\237\314\314\314\361\1\310\310\310\27\207\0"
-  "\0\0\0\2\314\314\314\5\314\314\314\221\217\314\314\314\361\2\217\265"
-  "\217\365\5\201\5\377\204\0\200\0\377\2""4\2234\373\242\274\242\364\204"
-  "\314\314\314\361\2\314\314\314\357\313\313\313I\203\0\0\0\0\2\0\203\0"
-  "#\0\200\0\356\207\0\200\0\377\1\0\200\0\303\254\0\0\0\0\1\314\314\314"
-  "y\237\314\314\314\362\1\310\310\310\27\206\0\0\0\0\2\310\310\310\16\314"
-  "\314\314\252\221\314\314\314\362\2\211\263\211\366\4\201\4\377\204\0"
-  "\200\0\377\3\1\200\1\377B\230B\373\254\300\254\364\202\314\314\314\362"
-  "\1\315\315\315u\203\0\0\0\0\2\0\200\0\12\0\200\0\321\210\0\200\0\377"
-  "\1\0\200\0H\255\0\0\0\0\1\315\315\315\204\236\314\314\314\363\1\310\310"
-  "\310\27\205\0\0\0\0\2\313\313\313'\313\313\313\316\223\314\314\314\363"
-  "\2\210\263\210\367\4\201\4\377\205\0\200\0\377\3\2\201\2\377B\230B\373"
-  "\235\273\235\222\204\0\0\0\0\1\0\200\0\245\210\0\200\0\377\1\0\200\0"
-  "\303\257\0\0\0\0\2\314\314\314j\313\313\313\362\234\314\314\314\364\1"
-  "\310\310\310\27\204\0\0\0\0\2\314\314\314Z\314\314\314\354\225\314\314"
-  "\314\364\2\200\260\200\370\2\200\2\377\206\0\200\0\377\5\0\200\0\364"
-  "\0\200\0\205\0\200\0\20\0\0\0\0\0\201\0g\211\0\200\0\377\1\0\200\0L\260"
-  "\0\0\0\0\2\314\314\314_\315\315\315\356\233\314\314\314\365\1\310\310"
-  "\310\27\202\0\0\0\0\3\377\377\377\1\315\315\315{\314\314\314\365\227"
-  "\314\314\314\366\2\177\260\177\371\2\201\2\377\207\0\200\0\377\3\0\200"
-  "\0\356\0\200\0\215\0\200\0\370\210\0\200\0\377\2\0\200\0\314\0\377\0"
-  "\1\261\0\0\0\0\2\317\317\3175\314\314\314\333\232\314\314\314\367\4\323"
-  "\323\323\27\0\0\0\0\310\310\310\16\314\314\314\253\232\314\314\314\367"
-  "\2\207\263\207\372\3\201\3\377\221\0\200\0\377\1\0\201\0I\263\0\0\0\0"
-  "\3\306\306\306\11\314\314\314|\313\313\313\362\230\314\314\314\370\3"
-  "\323\323\323\27\313\313\313,\314\314\314\326\233\314\314\314\370\3\314"
-  "\314\314\361d\245d\250\0\200\0\373\217\0\200\0\377\1\0\200\0\310\266"
-  "\0\0\0\0\2\315\315\315.\314\314\314\263\227\314\314\314\371\2\313\313"
-  "\313c\314\314\314\352\233\314\314\314\371\5\313\313\313\261\313\313\313"
-  ",\0\0\0\0\0\201\0W\0\200\0\374\216\0\200\0\377\1\0\200\0J\270\0\0\0\0"
-  "\3\312\312\312>\314\314\314\260\314\314\314\371\256\314\314\314\372\3"
-  "\314\314\314\370\314\314\314\257\315\315\315=\204\0\0\0\0\2\0\201\0_"
-  "\0\200\0\375\214\0\200\0\377\1\0\200\0\310\273\0\0\0\0\3\320\320\320"
-  "&\313\313\313\212\315\315\315\340\226\314\314\314\373\224\314\314\314"
-  "\374\3\315\315\315\340\314\314\314\210\310\310\310%\207\0\0\0\0\2\0\200"
-  "\0`\0\200\0\375\213\0\200\0\377\1\0\200\0J\275\0\0\0\0\4\377\377\377"
-  "\2\313\313\313@\314\314\314\214\314\314\314\323\244\314\314\314\375\4"
-  "\314\314\314\322\313\313\313\212\316\316\316\77\377\377\377\2\212\0\0"
-  "\0\0\2\0\201\0a\0\200\0\375\211\0\200\0\377\1\0\200\0\311\302\0\0\0\0"
-  "\5\310\310\310\34\314\314\314U\314\314\314\214\313\313\313\301\313\313"
-  "\313\350\232\314\314\314\376\5\314\314\314\347\315\315\315\300\314\314"
-  "\314\213\313\313\313T\306\306\306\33\217\0\0\0\0\2\0\200\0b\0\200\0\375"
-  "\210\0\200\0\377\1\0\201\0K\307\0\0\0\0\11\310\310\310\16\314\314\314"
-  "2\315\315\315Q\314\314\314n\314\314\314\214\314\314\314\246\313\313\313"
-  "\262\314\314\314\277\314\314\314\314\202\314\314\314\335\204\314\314"
-  "\314\356\202\314\314\314\335\11\314\314\314\314\314\314\314\277\313\313"
-  "\313\262\314\314\314\245\314\314\314\214\314\314\314n\314\314\314P\314"
-  "\314\3142\310\310\310\16\225\0\0\0\0\2\0\201\0c\0\200\0\375\206\0\200"
-  "\0\377\1\0\200\0\311\370\0\0\0\0\2\0\200\0d\0\200\0\376\205\0\200\0\377"
-  "\1\0\201\0K\371\0\0\0\0\2\0\201\0e\0\200\0\376\203\0\200\0\377\1\0\200"
-  "\0\311\373\0\0\0\0\2\0\200\0f\0\200\0\376\202\0\200\0\377\1\0\200\0L"
-  "\374\0\0\0\0\3\0\201\0o\0\200\0\377\0\200\0\311\376\0\0\0\0\2\0\200\0"
-  "z\0\200\0P\227\0\0\0\0",
-};
-
-
@@ -1,36 +0,0 @@
-/* GdkPixbuf RGBA C-Source image dump 1-byte-run-length-encoded */
-
-static const GdkPixdata close_red_inline = {
-  0x47646b50, /* Pixbuf magic: 'GdkP' */
-  24 + 635, /* header length + pixel_data length */
-  0x2010002, /* pixdata_type */
-  64, /* rowstride */
-  16, /* width */
-  16, /* height */
-  /* pixel_data: */
-  "\204\0\0\0\0\3\31344,\31077\217\31077\324\202\31077\353\3\30788\323\307"
-  "88\216\31077*\206\0\0\0\0\3\325++\6\31077\224\31077\374\206\31077\377"
-  "\3\31077\374\31077\221\31433\5\203\0\0\0\0\2\325++\6\31077\272\212\310"
-  "77\377\2\31077\270\325++\6\202\0\0\0\0\1\31077\231\203\31077\377\1\311"
-  "66\300\204\31077\377\1\31166\300\203\31077\377\4\31077\225\0\0\0\0\306"
-  "99-\31077\375\202\31077\377\3\31166\177\0\0\0\0\31077\203\202\31077\377"
-  "\3\31077\202\0\0\0\0\30788\200\202\31077\377\3\31077\374\31077*\3107"
-  "7\221\202\31077\377\1\31077\276\203\0\0\0\0\2\31077\207\31077\206\203"
-  "\0\0\0\0\1\31077\277\202\31077\377\2\30788\216\31077\326\203\31077\377"
-  "\1\30788|\206\0\0\0\0\1\31077}\203\31077\377\2\30788\323\31077\363\204"
-  "\31077\377\1\31077\201\204\0\0\0\0\1\31077\201\204\31077\377\2\31077"
-  "\362\31077\364\204\31077\377\1\31077\206\204\0\0\0\0\1\31077\207\204"
-  "\31077\377\2\31077\362\31077\326\203\31077\377\1\31077\202\206\0\0\0"
-  "\0\1\31077\203\203\31077\377\2\31077\324\31077\221\202\31077\377\1\310"
-  "77\277\203\0\0\0\0\2\31077y\31077x\203\0\0\0\0\1\31166\300\202\31077"
-  "\377\3\30788\216\31255+\31077\374\202\31077\377\3\31166\177\0\0\0\0\310"
-  "77}\202\31077\377\3\30788|\0\0\0\0\30788\200\202\31077\377\4\31077\373"
-  "\30699(\0\0\0\0\31077\220\203\31077\377\1\31077\277\204\31077\377\1\310"
-  "77\277\203\31077\377\1\31077\213\202\0\0\0\0\2\31433\5\31077\271\212"
-  "\31077\377\2\31166\267\277@@\4\203\0\0\0\0\3\325++\6\31077\224\31077"
-  "\374\206\31077\377\3\31077\374\31077\221\31433\5\206\0\0\0\0\3\31344"
-  ",\31077\217\31077\325\202\31077\367\3\31077\324\30788\216\31077*\204"
-  "\0\0\0\0",
-};
-
-
@@ -1,46 +0,0 @@
-/* GdkPixbuf RGBA C-Source image dump 1-byte-run-length-encoded */
-
-static const GdkPixdata close_inline = {
-  0x47646b50, /* Pixbuf magic: 'GdkP' */
-  24 + 648, /* header length + pixel_data length */
-  0x2010002, /* pixdata_type */
-  64, /* rowstride */
-  16, /* width */
-  16, /* height */
-  /* pixel_data: */
-  "\204\0\0\0\0\3\371\371\371,\373\373\373\217\375\375\375\324\202\374\374"
-  "\374\353\3\375\375\375\323\373\373\373\216\377\377\377*\206\0\0\0\0\3"
-  "\377\377\377\6\372\372\372\224\371\371\371\374\206\371\371\371\377\3"
-  "\371\371\371\374\372\372\372\221\377\377\377\5\203\0\0\0\0\2\377\377"
-  "\377\6\365\365\365\272\212\365\365\365\377\2\365\365\365\270\377\377"
-  "\377\6\202\0\0\0\0\1\362\362\362\231\203\361\361\361\377\1\360\360\360"
-  "\300\204\361\361\361\377\1\360\360\360\300\203\361\361\361\377\4\361"
-  "\361\361\225\0\0\0\0\356\356\356-\356\356\356\375\202\356\356\356\377"
-  "\3\357\357\357\177\0\0\0\0\355\355\355\203\202\356\356\356\377\3\355"
-  "\355\355\202\0\0\0\0\355\355\355\200\202\355\355\355\377\3\355\355\355"
-  "\374\355\355\355*\352\352\352\221\202\352\352\352\377\1\352\352\352\276"
-  "\203\0\0\0\0\2\352\352\352\207\352\352\352\206\203\0\0\0\0\1\352\352"
-  "\352\277\202\352\352\352\377\2\351\351\351\216\347\347\347\326\202\347"
-  "\347\347\377\2\346\346\346\377\346\346\346|\206\0\0\0\0\1\347\347\347"
-  "}\203\346\346\346\377\2\346\346\346\323\343\343\343\363\204\343\343\343"
-  "\377\1\343\343\343\201\204\0\0\0\0\2\343\343\343\201\343\343\343\377"
-  "\203\342\342\342\377\2\341\341\341\362\337\337\337\364\204\337\337\337"
-  "\377\1\337\337\337\206\204\0\0\0\0\1\337\337\337\207\204\337\337\337"
-  "\377\2\337\337\337\362\333\333\333\326\203\333\333\333\377\1\334\334"
-  "\334\202\206\0\0\0\0\1\334\334\334\203\203\333\333\333\377\2\333\333"
-  "\333\324\330\330\330\221\202\330\330\330\377\1\330\330\330\277\203\0"
-  "\0\0\0\2\327\327\327y\331\331\331x\203\0\0\0\0\1\330\330\330\300\202"
-  "\327\327\327\377\3\327\327\327\216\325\325\325+\325\325\325\374\202\324"
-  "\324\324\377\3\325\325\325\177\0\0\0\0\324\324\324}\202\324\324\324\377"
-  "\3\324\324\324|\0\0\0\0\323\323\323\200\202\324\324\324\377\4\324\324"
-  "\324\373\322\322\322(\0\0\0\0\317\317\317\220\203\320\320\320\377\1\320"
-  "\320\320\277\204\320\320\320\377\1\320\320\320\277\203\320\320\320\377"
-  "\1\317\317\317\213\202\0\0\0\0\2\314\314\314\5\315\315\315\271\204\315"
-  "\315\315\377\206\314\314\314\377\2\313\313\313\267\277\277\277\4\203"
-  "\0\0\0\0\3\325\325\325\6\312\312\312\224\311\311\311\374\206\311\311"
-  "\311\377\3\311\311\311\374\310\310\310\221\314\314\314\5\206\0\0\0\0"
-  "\3\305\305\305,\304\304\304\217\306\306\306\325\202\305\305\305\367\3"
-  "\305\305\305\324\306\306\306\216\302\302\302*\204\0\0\0\0",
-};
-
-
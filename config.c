@@ -0,0 +1,665 @@
+/**
+ * Configuration file, reloaded in place while resident.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * $XDG_CONFIG_HOME/grfkill/grfkill.conf (or --config) is a key file:
+ *
+ *	[Selectors]
+ *	wlan=acer-wireless;phy*
+ *	bluetooth=hci0
+ *
+ *	[Icons]
+ *	wlan=/home/me/.local/share/grfkill/wlan.svg
+ *
+ *	[Profile office]
+ *	wlan=on
+ *	bluetooth=off
+ *
+ *	[Rule morning]
+ *	at=09:00
+ *	do=profile office
+ *
+ * Selectors take the --wlan/--bluetooth syntax and the command line wins
+ * over them. Icons replace the built-in SVG of bluetooth, wlan, wwan or
+ * close. Profile keys are rfkill type names, "all" for every radio, and
+ * on or off. Rules are described in policy.c.
+ *
+ * config_watch puts one inotify watch on the directory of the file and
+ * on the directory of each icon override, all on a single fd, so editors
+ * that save by renaming are seen too and nothing polls. A directory that
+ * does not exist yet is watched through its nearest existing ancestor,
+ * and the watch moves down as the missing levels are created. A new
+ * version is parsed and checked in full before anything is applied; if
+ * it fails, the old one stays in effect. The callback is told which
+ * parts changed.
+ */
+
+#include <glib.h>
+#include <glib-unix.h>
+#include <sys/inotify.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+
+#define CONFIG_FILE   "grfkill.conf"
+#define MAX_WATCHES   (GRFKILL_N_ICONS + 1)
+#define WATCH_EVENTS  (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE)
+
+static const gchar *const class_keys[GRFKILL_N_CLASSES] = {
+	[GRFKILL_CLASS_WLAN] = "wlan",
+	[GRFKILL_CLASS_BT]   = "bluetooth",
+};
+
+static const gchar *const icon_keys[GRFKILL_N_ICONS] = {
+	[GRFKILL_ICON_BT]    = "bluetooth",
+	[GRFKILL_ICON_WLAN]  = "wlan",
+	[GRFKILL_ICON_WWAN]  = "wwan",
+	[GRFKILL_ICON_CLOSE] = "close",
+};
+
+typedef struct {
+	gint   wd;
+	gchar *dir;
+	gchar *watched;		/* dir, or its nearest ancestor while dir is missing */
+} ConfigWatch;
+
+static gchar *config_path = NULL;
+static GrfkillConfig config;
+static ConfigChangedFunc changed_func;
+
+static gint inotify_fd = -1;
+static ConfigWatch watches[MAX_WATCHES];
+static guint n_watches = 0;
+
+static void
+config_clear (GrfkillConfig *cfg)
+{
+	guint i;
+
+	for (i = 0; i < GRFKILL_N_CLASSES; i++)
+		g_strfreev (cfg->selectors[i]);
+	for (i = 0; i < GRFKILL_N_ICONS; i++)
+		g_free (cfg->icons[i]);
+	memset (cfg, 0, sizeof (GrfkillConfig));
+}
+
+/* rfkill type names, "bt" for short */
+static guint
+parse_type (const gchar *name)
+{
+	if (g_strcmp0 (name, "bt") == 0)
+		return RFKILL_TYPE_BLUETOOTH;
+
+	return rfkill_type_from_name (name);
+}
+
+static gboolean
+parse_profile (GKeyFile       *file,
+	       const gchar    *group,
+	       RfkillProfile  *profile,
+	       GError        **error)
+{
+	gchar **keys;
+	gchar **key;
+	gchar *value;
+	guint type;
+	gboolean ok = TRUE;
+
+	memset (profile, 0, sizeof (RfkillProfile));
+	g_strlcpy (profile->name, g_strstrip (group + strlen ("Profile ")),
+		   sizeof (profile->name));
+
+	keys = g_key_file_get_keys (file, group, NULL, NULL);
+	for (key = keys; ok && key && *key; key++) {
+		type = parse_type (*key);
+		value = g_key_file_get_string (file, group, *key, NULL);
+		if (type == NUM_RFKILL_TYPES) {
+			g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+				     "[%s]: unknown rfkill type \"%s\"", group, *key);
+			ok = FALSE;
+		} else if (g_strcmp0 (value, "on") == 0) {
+			profile->state[type] = PROFILE_UNBLOCK;
+		} else if (g_strcmp0 (value, "off") == 0) {
+			profile->state[type] = PROFILE_BLOCK;
+		} else {
+			g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+				     "[%s]: %s must be on or off", group, *key);
+			ok = FALSE;
+		}
+		g_free (value);
+	}
+	g_strfreev (keys);
+
+	return ok;
+}
+
+/* 10s, 10m, 2h; plain numbers are seconds */
+static gboolean
+parse_duration (const gchar *text, guint32 *seconds)
+{
+	guint64 value;
+	gchar *end;
+
+	value = g_ascii_strtoull (text, &end, 10);
+	if (end == text)
+		return FALSE;
+	if (g_strcmp0 (end, "m") == 0)
+		value *= 60;
+	else if (g_strcmp0 (end, "h") == 0)
+		value *= 3600;
+	else if (*end != '\0' && g_strcmp0 (end, "s") != 0)
+		return FALSE;
+	if (value == 0 || value > G_MAXUINT32)
+		return FALSE;
+
+	*seconds = value;
+	return TRUE;
+}
+
+/* "lid closed", "wlan connected", "bluetooth idle 10m" or "wwan blocked" */
+static gboolean
+parse_trigger (const gchar *when, PolicyRule *rule)
+{
+	gchar **words = g_strsplit_set (when, " \t", -1);
+	gchar **w = words;
+	gchar **packed = words;
+	gboolean ok = FALSE;
+	guint n;
+
+	/* drop the empty strings runs of blanks leave */
+	for (; *w; w++) {
+		if (**w)
+			*packed++ = *w;
+		else
+			g_free (*w);
+	}
+	*packed = NULL;
+	n = packed - words;
+
+	if (n == 2 && strcmp (words[0], "lid") == 0) {
+		rule->trigger = RULE_LID;
+		ok = strcmp (words[1], "closed") == 0;
+	} else if (n >= 2 && (rule->type = parse_type (words[0])) != NUM_RFKILL_TYPES) {
+		if (n == 2 && strcmp (words[1], "connected") == 0) {
+			/* link state is all the kernel tells about wlan */
+			rule->trigger = RULE_CONNECTED;
+			ok = rule->type == RFKILL_TYPE_WLAN;
+		} else if (n == 3 && strcmp (words[1], "idle") == 0) {
+			/* and connections are only visible for bluetooth */
+			rule->trigger = RULE_IDLE;
+			ok = rule->type == RFKILL_TYPE_BLUETOOTH &&
+				parse_duration (words[2], &rule->seconds);
+		} else if (n == 2) {
+			rule->trigger = RULE_STATE;
+			rule->blocked = strcmp (words[1], "blocked") == 0;
+			ok = rule->blocked || strcmp (words[1], "unblocked") == 0;
+		}
+	}
+
+	g_strfreev (words);
+	return ok;
+}
+
+/* "block wwan", "unblock all" or "profile office" */
+static gboolean
+parse_action (const gchar *what, PolicyRule *rule)
+{
+	const gchar *arg = strchr (what, ' ');
+	gsize len;
+
+	if (arg == NULL)
+		return FALSE;
+	len = arg - what;
+	while (*arg == ' ')
+		arg++;
+
+	if (len == strlen ("profile") && strncmp (what, "profile", len) == 0) {
+		rule->action = RULE_PROFILE;
+		return g_strlcpy (rule->profile, arg, sizeof (rule->profile)) < sizeof (rule->profile);
+	}
+
+	if (len == strlen ("block") && strncmp (what, "block", len) == 0)
+		rule->action = RULE_BLOCK;
+	else if (len == strlen ("unblock") && strncmp (what, "unblock", len) == 0)
+		rule->action = RULE_UNBLOCK;
+	else
+		return FALSE;
+
+	rule->action_type = parse_type (arg);
+	return rule->action_type != NUM_RFKILL_TYPES;
+}
+
+static gboolean
+parse_rule (GKeyFile       *file,
+	    const gchar    *group,
+	    PolicyRule     *rule,
+	    GError        **error)
+{
+	gchar *when = g_key_file_get_string (file, group, "when", NULL);
+	gchar *at = g_key_file_get_string (file, group, "at", NULL);
+	gchar *what = g_key_file_get_string (file, group, "do", NULL);
+	guint hours, minutes;
+	gchar end;
+	gboolean ok = FALSE;
+
+	memset (rule, 0, sizeof (PolicyRule));
+	g_strlcpy (rule->name, g_strstrip (group + strlen ("Rule ")), sizeof (rule->name));
+
+	if ((when == NULL) == (at == NULL)) {
+		g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+			     "[%s]: needs either when or at", group);
+	} else if (when && !parse_trigger (g_strstrip (when), rule)) {
+		g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+			     "[%s]: cannot wait for \"%s\"", group, when);
+	} else if (at && (sscanf (at, "%u:%u%c", &hours, &minutes, &end) != 2 ||
+			  hours > 23 || minutes > 59)) {
+		g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+			     "[%s]: at must be HH:MM", group);
+	} else if (what == NULL || !parse_action (g_strstrip (what), rule)) {
+		g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+			     "[%s]: do must be block TYPE, unblock TYPE or profile NAME", group);
+	} else {
+		if (at) {
+			rule->trigger = RULE_AT;
+			rule->seconds = hours * 3600 + minutes * 60;
+		}
+		ok = TRUE;
+	}
+
+	g_free (when);
+	g_free (at);
+	g_free (what);
+	return ok;
+}
+
+/* all or nothing: cfg is only filled when the whole file is valid */
+static gboolean
+config_parse (const gchar *path, GrfkillConfig *cfg, GError **error)
+{
+	GrfkillConfig parsed = { { NULL } };
+	RfkillMatcher scratch = { 0 };
+	GKeyFile *file;
+	GError *err = NULL;
+	gchar **groups;
+	gchar **group;
+	gchar *value;
+	gboolean ok = TRUE;
+	guint i, j;
+
+	file = g_key_file_new ();
+	if (!g_key_file_load_from_file (file, path, G_KEY_FILE_NONE, &err)) {
+		g_key_file_free (file);
+		/* no file is an empty configuration */
+		if (g_error_matches (err, G_FILE_ERROR, G_FILE_ERROR_NOENT)) {
+			g_error_free (err);
+			config_clear (cfg);
+			return TRUE;
+		}
+		g_propagate_error (error, err);
+		return FALSE;
+	}
+
+	for (i = 0; ok && i < GRFKILL_N_CLASSES; i++) {
+		parsed.selectors[i] = g_key_file_get_string_list (file, "Selectors",
+								  class_keys[i], NULL, NULL);
+		/* compiled here only to reject it before anything changes */
+		if (parsed.selectors[i])
+			ok = rfkill_matcher_compile (&scratch, parsed.selectors[i], error);
+		rfkill_matcher_clear (&scratch);
+	}
+
+	for (i = 0; ok && i < GRFKILL_N_ICONS; i++) {
+		value = g_key_file_get_string (file, "Icons", icon_keys[i], NULL);
+		if (value && !g_path_is_absolute (value)) {
+			g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+				     "[Icons]: %s needs an absolute path", icon_keys[i]);
+			ok = FALSE;
+		} else if (value) {
+			/* without "..", so it compares with the names inotify reports */
+			parsed.icons[i] = g_canonicalize_filename (value, NULL);
+		}
+		g_free (value);
+	}
+
+	groups = g_key_file_get_groups (file, NULL);
+	for (group = groups; ok && *group; group++) {
+		if (!g_str_has_prefix (*group, "Profile "))
+			continue;
+		if (parsed.n_profiles == CONFIG_MAX_PROFILES) {
+			g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+				     "more than %d profiles", CONFIG_MAX_PROFILES);
+			ok = FALSE;
+			break;
+		}
+		ok = parse_profile (file, *group, &parsed.profiles[parsed.n_profiles++], error);
+	}
+	for (group = groups; ok && *group; group++) {
+		if (!g_str_has_prefix (*group, "Rule "))
+			continue;
+		if (parsed.n_rules == CONFIG_MAX_RULES) {
+			g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+				     "more than %d rules", CONFIG_MAX_RULES);
+			ok = FALSE;
+			break;
+		}
+		ok = parse_rule (file, *group, &parsed.rules[parsed.n_rules++], error);
+	}
+	g_strfreev (groups);
+
+	/* profiles can come after the rules that name them */
+	for (i = 0; ok && i < parsed.n_rules; i++) {
+		if (parsed.rules[i].action != RULE_PROFILE)
+			continue;
+		for (j = 0; j < parsed.n_profiles; j++)
+			if (strcmp (parsed.profiles[j].name, parsed.rules[i].profile) == 0)
+				break;
+		if (j == parsed.n_profiles) {
+			g_set_error (error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_INVALID_VALUE,
+				     "[Rule %s]: no profile \"%s\"",
+				     parsed.rules[i].name, parsed.rules[i].profile);
+			ok = FALSE;
+		}
+	}
+	g_key_file_free (file);
+
+	if (!ok) {
+		config_clear (&parsed);
+		return FALSE;
+	}
+
+	config_clear (cfg);
+	*cfg = parsed;
+	return TRUE;
+}
+
+static gboolean
+strv_equal (gchar **a, gchar **b)
+{
+	if (a == NULL || b == NULL)
+		return a == b;
+
+	for (; *a && *b; a++, b++)
+		if (strcmp (*a, *b) != 0)
+			return FALSE;
+
+	return *a == *b;
+}
+
+/* TRUE if dir itself is watched, FALSE if only an ancestor or nothing */
+static gboolean
+add_watch (const gchar *dir)
+{
+	gchar *path;
+	gchar *parent;
+	guint i;
+	gint wd;
+	gint err;
+
+	for (i = 0; i < n_watches; i++)
+		if (strcmp (watches[i].dir, dir) == 0)
+			return strcmp (watches[i].watched, dir) == 0;
+	if (n_watches == MAX_WATCHES)
+		return FALSE;
+
+	/* no config directory yet is the common case: wait for it one level up */
+	path = g_strdup (dir);
+	while ((wd = inotify_add_watch (inotify_fd, path, WATCH_EVENTS | IN_ONLYDIR)) < 0 &&
+	       (errno == ENOENT || errno == ENOTDIR)) {
+		parent = g_path_get_dirname (path);
+		if (strcmp (parent, path) == 0) {
+			g_free (parent);
+			break;
+		}
+		g_free (path);
+		path = parent;
+	}
+	if (wd < 0) {
+		err = errno;
+		g_warning ("Cannot watch %s: %s", path, g_strerror (err));
+		g_free (path);
+		return FALSE;
+	}
+
+	watches[n_watches].wd = wd;
+	watches[n_watches].dir = g_strdup (dir);
+	watches[n_watches].watched = path;
+	n_watches++;
+
+	return strcmp (path, dir) == 0;
+}
+
+/* two missing directories can wait on the same ancestor, and share its wd */
+static void
+drop_watch (guint i)
+{
+	gboolean shared = FALSE;
+	guint j;
+
+	for (j = 0; j < n_watches; j++)
+		shared = shared || (j != i && watches[j].wd == watches[i].wd);
+	if (!shared)
+		inotify_rm_watch (inotify_fd, watches[i].wd);
+
+	g_free (watches[i].dir);
+	g_free (watches[i].watched);
+	watches[i] = watches[--n_watches];
+}
+
+/* a directory appeared: move the waiting watches down, TRUE if one arrived */
+static gboolean
+rewatch_missing (void)
+{
+	gchar *dirs[MAX_WATCHES];
+	gboolean arrived = FALSE;
+	guint n = 0;
+	guint i;
+
+	for (i = 0; i < n_watches; ) {
+		if (strcmp (watches[i].watched, watches[i].dir) == 0) {
+			i++;
+			continue;
+		}
+		dirs[n++] = g_strdup (watches[i].dir);
+		drop_watch (i);
+	}
+
+	for (i = 0; i < n; i++) {
+		arrived |= add_watch (dirs[i]);
+		g_free (dirs[i]);
+	}
+
+	return arrived;
+}
+
+/* the config directory, plus one per directory holding an icon override */
+static void
+update_watches (void)
+{
+	gchar *dirs[MAX_WATCHES] = { NULL };
+	gboolean keep;
+	guint i, j;
+
+	dirs[0] = g_path_get_dirname (config_path);
+	for (i = 0; i < GRFKILL_N_ICONS; i++)
+		if (config.icons[i])
+			dirs[i + 1] = g_path_get_dirname (config.icons[i]);
+
+	for (i = 0; i < n_watches; ) {
+		keep = FALSE;
+		for (j = 0; j < MAX_WATCHES; j++)
+			keep = keep || g_strcmp0 (dirs[j], watches[i].dir) == 0;
+		if (keep)
+			i++;
+		else
+			drop_watch (i);
+	}
+
+	for (j = 0; j < MAX_WATCHES; j++) {
+		if (dirs[j])
+			add_watch (dirs[j]);
+		g_free (dirs[j]);
+	}
+}
+
+static void
+reload (guint icons_touched)
+{
+	GrfkillConfig fresh = { { NULL } };
+	GError *err = NULL;
+	guint changed = 0;
+	guint icons_changed = icons_touched;
+	guint i;
+
+	if (!config_parse (config_path, &fresh, &err)) {
+		g_warning ("%s: %s; keeping the previous configuration",
+			   config_path, err->message);
+		g_error_free (err);
+		return;
+	}
+
+	for (i = 0; i < GRFKILL_N_CLASSES; i++)
+		if (!strv_equal (fresh.selectors[i], config.selectors[i]))
+			changed |= CONFIG_CHANGED_SELECTORS (i);
+	for (i = 0; i < GRFKILL_N_ICONS; i++)
+		if (g_strcmp0 (fresh.icons[i], config.icons[i]) != 0)
+			icons_changed |= 1 << i;
+	if (fresh.n_profiles != config.n_profiles ||
+	    memcmp (fresh.profiles, config.profiles,
+		    fresh.n_profiles * sizeof (RfkillProfile)) != 0)
+		changed |= CONFIG_CHANGED_PROFILES;
+	if (fresh.n_rules != config.n_rules ||
+	    memcmp (fresh.rules, config.rules,
+		    fresh.n_rules * sizeof (PolicyRule)) != 0)
+		changed |= CONFIG_CHANGED_RULES;
+	if (icons_changed)
+		changed |= CONFIG_CHANGED_ICONS;
+
+	config_clear (&config);
+	config = fresh;
+
+	if (icons_changed)
+		update_watches ();
+	if (changed)
+		changed_func (&config, changed, icons_changed);
+}
+
+/* drains the fd, then applies the whole batch at once */
+static gboolean
+inotify_cb (gint         fd,
+	    GIOCondition condition,
+	    gpointer     data)
+{
+	gchar buf[4096] __attribute__ ((aligned (__alignof__ (struct inotify_event))));
+	const struct inotify_event *event;
+	gboolean config_touched = FALSE;
+	gboolean appeared = FALSE;
+	guint icons_touched = 0;
+	gchar *path;
+	gssize len;
+	gchar *p;
+	guint i;
+
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_CONFIG);
+
+	while ((len = read (fd, buf, sizeof (buf))) > 0) {
+		for (p = buf; p < buf + len; p += sizeof (struct inotify_event) + event->len) {
+			event = (const struct inotify_event *) p;
+			if (event->len == 0)
+				continue;
+
+			for (i = 0; i < n_watches; i++)
+				if (watches[i].wd == event->wd &&
+				    strcmp (watches[i].watched, watches[i].dir) != 0 &&
+				    (event->mask & IN_ISDIR) &&
+				    (event->mask & (IN_CREATE | IN_MOVED_TO)))
+					appeared = TRUE;
+
+			for (i = 0; i < n_watches; i++)
+				if (watches[i].wd == event->wd)
+					break;
+			if (i == n_watches)
+				continue;
+
+			path = g_build_filename (watches[i].watched, event->name, NULL);
+			if (strcmp (path, config_path) == 0)
+				config_touched = TRUE;
+			for (i = 0; i < GRFKILL_N_ICONS; i++)
+				if (g_strcmp0 (path, config.icons[i]) == 0)
+					icons_touched |= 1 << i;
+			g_free (path);
+		}
+	}
+
+	/* whatever was written before the new watch was in place counts too */
+	if (appeared && rewatch_missing ()) {
+		config_touched = TRUE;
+		for (i = 0; i < GRFKILL_N_ICONS; i++)
+			if (config.icons[i])
+				icons_touched |= 1 << i;
+	}
+
+	if (config_touched || icons_touched)
+		reload (icons_touched);
+
+	return G_SOURCE_CONTINUE;
+}
+
+/* path NULL for the default; a broken file is reported and ignored */
+const GrfkillConfig *
+config_open (const gchar *path)
+{
+	GError *err = NULL;
+
+	config_path = path ? g_canonicalize_filename (path, NULL) :
+		g_build_filename (g_get_user_config_dir (), "grfkill", CONFIG_FILE, NULL);
+
+	if (!config_parse (config_path, &config, &err)) {
+		g_warning ("%s: %s", config_path, err->message);
+		g_error_free (err);
+	}
+
+	return &config;
+}
+
+/* resident only: apply edits to the file and the icons it names */
+void
+config_watch (ConfigChangedFunc func)
+{
+	changed_func = func;
+
+	inotify_fd = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+	if (inotify_fd < 0) {
+		g_warning ("No config reloading: %s", g_strerror (errno));
+		return;
+	}
+
+	update_watches ();
+	g_unix_fd_add (inotify_fd, G_IO_IN, inotify_cb, NULL);
+}
+
+/* what a profile wants for a radio of this type */
+guint
+config_profile_state (const RfkillProfile *profile, guint8 type)
+{
+	if (type < NUM_RFKILL_TYPES && profile->state[type] != PROFILE_KEEP)
+		return profile->state[type];
+
+	return profile->state[RFKILL_TYPE_ALL];
+}
+
+const RfkillProfile *
+config_profile (const gchar *name)
+{
+	guint i;
+
+	for (i = 0; i < config.n_profiles; i++)
+		if (strcmp (config.profiles[i].name, name) == 0)
+			return &config.profiles[i];
+
+	return NULL;
+}
@@ -0,0 +1,548 @@
+/**
+ * Radio duty-cycle accounting.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * A resident grfkill appends one fixed-size record to
+ * $XDG_DATA_HOME/grfkill/dutycycle.log whenever a device changes between
+ * unblocked, soft-blocked and hard-blocked, stamped with the wall clock
+ * when the rfkill event arrived. Time per state is the distance between
+ * consecutive records, so nothing is ever sampled.
+ *
+ * When the log grows past a threshold it is compacted: everything before
+ * local midnight is folded into one summary record per day and device,
+ * and each device's state at midnight is carried over as a new
+ * transition. That happens in duty_open, or from a low priority idle
+ * source once an event crossed the threshold, never in the event
+ * itself. "grfkill --duty-cycle" replays the log and prints the totals
+ * per day and device.
+ *
+ * The log outlives reboots, but rfkill indices are handed out afresh on
+ * every boot. Transitions are therefore stamped with part of the kernel's
+ * boot_id, and a new one ends every interval still open at the last
+ * record of the old boot, so rfkill0 before and after are not merged.
+ */
+
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "grfkill.h"
+
+#define COMPACT_RECORDS 1024
+#define BOOT_ID "/proc/sys/kernel/random/boot_id"
+
+enum {
+	DUTY_UNBLOCKED,
+	DUTY_SOFT,
+	DUTY_HARD,
+	N_DUTY_STATES,
+	DUTY_GONE = N_DUTY_STATES	/* device removed or grfkill exited */
+};
+
+enum {
+	RECORD_TRANSITION,
+	RECORD_SUMMARY
+};
+
+typedef struct {
+	gint64  time;		/* transition: wall clock usec, summary: local midnight */
+	guint32 idx;
+	guint8  type;
+	guint8  kind;
+	guint8  state;		/* transition only */
+	guint8  pad;
+	guint32 secs[N_DUTY_STATES];	/* summary only */
+	guint32 boot;		/* transition only, see boot_tag */
+} DutyRecord;
+
+G_STATIC_ASSERT (sizeof (DutyRecord) == 32);
+
+typedef struct {
+	gint32  day;		/* YYYYMMDD */
+	guint32 idx;
+	guint8  type;
+	gint64  usec[N_DUTY_STATES];
+} DayBucket;
+
+typedef struct {
+	guint32 idx;
+	guint8  type;
+	guint8  state;
+	gint64  since;
+} DeviceTrack;
+
+static gchar *log_path = NULL;
+static gint log_fd = -1;
+static gsize log_records = 0;
+static gsize compact_at = COMPACT_RECORDS;
+static guint compact_id = 0;
+static guint32 boot_tag = 0;	/* first 32 bits of this boot's boot_id */
+
+static DeviceTrack tracked[GRFKILL_MAX_DEVICES];
+static guint n_tracked = 0;
+
+static guint8
+device_state (const RfkillDevice *dev)
+{
+	if (dev->hard)
+		return DUTY_HARD;
+	return dev->soft ? DUTY_SOFT : DUTY_UNBLOCKED;
+}
+
+/* local day of @usec as YYYYMMDD, and the start of the next one */
+static gint64
+next_midnight (gint64 usec, gint32 *day)
+{
+	GDateTime *t;
+	GDateTime *start;
+	GDateTime *next;
+	gint64 result;
+
+	t = g_date_time_new_from_unix_local (usec / G_USEC_PER_SEC);
+	start = g_date_time_new_local (g_date_time_get_year (t),
+				       g_date_time_get_month (t),
+				       g_date_time_get_day_of_month (t), 0, 0, 0);
+	next = g_date_time_add_days (start, 1);
+
+	*day = g_date_time_get_year (t) * 10000 +
+	       g_date_time_get_month (t) * 100 +
+	       g_date_time_get_day_of_month (t);
+	result = g_date_time_to_unix (next) * G_USEC_PER_SEC;
+
+	g_date_time_unref (next);
+	g_date_time_unref (start);
+	g_date_time_unref (t);
+
+	return result;
+}
+
+static gint64
+day_start (gint32 day)
+{
+	GDateTime *t;
+	gint64 usec;
+
+	t = g_date_time_new_local (day / 10000, day / 100 % 100, day % 100, 0, 0, 0);
+	usec = g_date_time_to_unix (t) * G_USEC_PER_SEC;
+	g_date_time_unref (t);
+
+	return usec;
+}
+
+static DayBucket *
+bucket_for (GArray *buckets, gint32 day, guint32 idx, guint8 type)
+{
+	DayBucket *bucket;
+	DayBucket fresh = { day, idx, type, { 0 } };
+	guint i;
+
+	for (i = 0; i < buckets->len; i++) {
+		bucket = &g_array_index (buckets, DayBucket, i);
+		if (bucket->day == day && bucket->idx == idx && bucket->type == type)
+			return bucket;
+	}
+
+	g_array_append_val (buckets, fresh);
+	return &g_array_index (buckets, DayBucket, buckets->len - 1);
+}
+
+/* add [from, to) in @state to the buckets, split at local midnights */
+static void
+account (GArray *buckets, const DeviceTrack *track, gint64 to)
+{
+	gint64 from = track->since;
+	gint64 end;
+	gint32 day;
+
+	if (track->state >= N_DUTY_STATES)
+		return;
+
+	while (from < to) {
+		end = MIN (to, next_midnight (from, &day));
+		bucket_for (buckets, day, track->idx, track->type)->usec[track->state] += end - from;
+		from = end;
+	}
+}
+
+/* the machine went down: nothing that was open goes on past @to */
+static void
+end_boot (GArray *buckets, GArray *tracks, gint64 to)
+{
+	guint i;
+
+	for (i = 0; i < tracks->len; i++)
+		account (buckets, &g_array_index (tracks, DeviceTrack, i), to);
+	g_array_set_size (tracks, 0);
+}
+
+static DeviceTrack *
+track_for (GArray *tracks, guint32 idx)
+{
+	DeviceTrack fresh = { idx, 0, DUTY_GONE, 0 };
+	guint i;
+
+	for (i = 0; i < tracks->len; i++)
+		if (g_array_index (tracks, DeviceTrack, i).idx == idx)
+			return &g_array_index (tracks, DeviceTrack, i);
+
+	g_array_append_val (tracks, fresh);
+	return &g_array_index (tracks, DeviceTrack, tracks->len - 1);
+}
+
+/*
+ * Fold @n records into per-day buckets. Intervals open in this boot end
+ * at @cutoff, those of an earlier one at its last record.
+ */
+static void
+replay (const DutyRecord *records, gsize n, gint64 cutoff,
+	GArray *buckets, GArray *tracks)
+{
+	const DutyRecord *rec;
+	DeviceTrack *track;
+	DayBucket *bucket;
+	guint32 boot = 0;
+	gint64 last = 0;
+	gint32 day;
+	guint i;
+
+	for (rec = records; rec < records + n; rec++) {
+		if (rec->kind == RECORD_SUMMARY) {
+			next_midnight (rec->time, &day);
+			bucket = bucket_for (buckets, day, rec->idx, rec->type);
+			for (i = 0; i < N_DUTY_STATES; i++)
+				bucket->usec[i] += (gint64) rec->secs[i] * G_USEC_PER_SEC;
+			continue;
+		}
+
+		if (rec->boot != boot) {
+			end_boot (buckets, tracks, MIN (last, cutoff));
+			boot = rec->boot;
+		}
+		last = rec->time;
+
+		track = track_for (tracks, rec->idx);
+		account (buckets, track, MIN (rec->time, cutoff));
+		track->type = rec->type;
+		track->state = rec->state;
+		track->since = rec->time;
+	}
+
+	if (boot != boot_tag)
+		end_boot (buckets, tracks, MIN (last, cutoff));
+	for (i = 0; i < tracks->len; i++)
+		account (buckets, &g_array_index (tracks, DeviceTrack, i), cutoff);
+}
+
+static gboolean
+read_log (DutyRecord **records, gsize *n, GError **error)
+{
+	gchar *data;
+	gsize len;
+
+	if (!g_file_get_contents (log_path, &data, &len, error))
+		return FALSE;
+
+	*records = (DutyRecord *) data;
+	*n = len / sizeof (DutyRecord);
+	return TRUE;
+}
+
+static void
+compact (void)
+{
+	DutyRecord *records;
+	DutyRecord *rec;
+	DutyRecord out;
+	DeviceTrack *track;
+	DayBucket *bucket;
+	GArray *buckets;
+	GArray *tracks;
+	GArray *result;
+	GError *err = NULL;
+	gint64 midnight;
+	gint32 today;
+	gsize n;
+	gsize old;
+	guint i;
+	guint s;
+
+	if (!read_log (&records, &n, NULL))
+		return;
+
+	next_midnight (g_get_real_time (), &today);
+	midnight = day_start (today);
+
+	for (old = 0; old < n && (records[old].kind == RECORD_SUMMARY ||
+				  records[old].time < midnight); old++)
+		;
+
+	buckets = g_array_new (FALSE, FALSE, sizeof (DayBucket));
+	tracks = g_array_new (FALSE, FALSE, sizeof (DeviceTrack));
+	result = g_array_new (FALSE, TRUE, sizeof (DutyRecord));
+	replay (records, old, midnight, buckets, tracks);
+
+	for (i = 0; i < buckets->len; i++) {
+		bucket = &g_array_index (buckets, DayBucket, i);
+		memset (&out, 0, sizeof (out));
+		out.time = day_start (bucket->day);
+		out.kind = RECORD_SUMMARY;
+		out.idx = bucket->idx;
+		out.type = bucket->type;
+		for (s = 0; s < N_DUTY_STATES; s++)
+			out.secs[s] = bucket->usec[s] / G_USEC_PER_SEC;
+		g_array_append_val (result, out);
+	}
+
+	for (i = 0; i < tracks->len; i++) {
+		track = &g_array_index (tracks, DeviceTrack, i);
+		if (track->state == DUTY_GONE)
+			continue;
+		memset (&out, 0, sizeof (out));
+		out.time = midnight;
+		out.kind = RECORD_TRANSITION;
+		out.idx = track->idx;
+		out.type = track->type;
+		out.state = track->state;
+		out.boot = boot_tag;
+		g_array_append_val (result, out);
+	}
+
+	for (rec = records + old; rec < records + n; rec++)
+		g_array_append_val (result, *rec);
+
+	if (!g_file_set_contents (log_path, result->data,
+				  result->len * sizeof (DutyRecord), &err)) {
+		g_warning ("Failed to compact %s: %s", log_path, err->message);
+		g_error_free (err);
+	} else {
+		log_records = result->len;
+	}
+
+	compact_at = MAX (COMPACT_RECORDS, log_records * 2);
+
+	g_array_free (result, TRUE);
+	g_array_free (tracks, TRUE);
+	g_array_free (buckets, TRUE);
+	g_free (records);
+}
+
+/* rewriting the log is slow, so it never runs in the rfkill event path */
+static gboolean
+compact_idle_cb (gpointer user_data)
+{
+	compact_id = 0;
+
+	close (log_fd);
+	compact ();
+	log_fd = open (log_path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0600);
+
+	return G_SOURCE_REMOVE;
+}
+
+static void
+append (guint32 idx, guint8 type, guint8 state)
+{
+	DutyRecord rec;
+
+	if (log_fd < 0)
+		return;
+
+	memset (&rec, 0, sizeof (rec));
+	rec.time = g_get_real_time ();
+	rec.kind = RECORD_TRANSITION;
+	rec.idx = idx;
+	rec.type = type;
+	rec.state = state;
+	rec.boot = boot_tag;
+
+	/* O_APPEND makes a single 32 byte write atomic */
+	if (write (log_fd, &rec, sizeof (rec)) != sizeof (rec))
+		return;
+
+	if (++log_records >= compact_at && compact_id == 0)
+		compact_id = g_idle_add_full (G_PRIORITY_LOW, compact_idle_cb, NULL, NULL);
+}
+
+static DeviceTrack *
+find_tracked (guint32 idx)
+{
+	guint i;
+
+	for (i = 0; i < n_tracked; i++)
+		if (tracked[i].idx == idx)
+			return &tracked[i];
+
+	return NULL;
+}
+
+/* changes on every boot, 0 without procfs */
+static guint32
+read_boot_tag (void)
+{
+	gchar *text = NULL;
+	guint32 tag = 0;
+
+	/* "xxxxxxxx-xxxx-...", the first group is enough to tell boots apart */
+	if (g_file_get_contents (BOOT_ID, &text, NULL, NULL))
+		tag = g_ascii_strtoull (text, NULL, 16);
+	g_free (text);
+
+	return tag;
+}
+
+static void
+init_path (void)
+{
+	if (log_path == NULL) {
+		log_path = g_build_filename (g_get_user_data_dir (), "grfkill",
+					     "dutycycle.log", NULL);
+		boot_tag = read_boot_tag ();
+	}
+}
+
+void
+duty_open (void)
+{
+	gchar *dir;
+	struct stat st;
+
+	init_path ();
+	dir = g_path_get_dirname (log_path);
+	g_mkdir_with_parents (dir, 0700);
+	g_free (dir);
+
+	if (g_stat (log_path, &st) == 0) {
+		log_records = st.st_size / sizeof (DutyRecord);
+		if (log_records >= compact_at)
+			compact ();
+	}
+
+	log_fd = open (log_path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0600);
+}
+
+void
+duty_record (const RfkillDevice *dev)
+{
+	DeviceTrack *track = find_tracked (dev->idx);
+	guint8 state = device_state (dev);
+
+	if (log_fd < 0)
+		return;
+
+	if (track == NULL) {
+		if (n_tracked == GRFKILL_MAX_DEVICES)
+			return;
+		track = &tracked[n_tracked++];
+		track->idx = dev->idx;
+	} else if (track->state == state) {
+		return;
+	}
+
+	track->type = dev->type;
+	track->state = state;
+	append (dev->idx, dev->type, state);
+}
+
+void
+duty_record_gone (guint32 idx)
+{
+	DeviceTrack *track = find_tracked (idx);
+
+	if (log_fd < 0 || track == NULL)
+		return;
+
+	append (idx, track->type, DUTY_GONE);
+	*track = tracked[--n_tracked];
+}
+
+void
+duty_close (void)
+{
+	while (log_fd >= 0 && n_tracked > 0)
+		duty_record_gone (tracked[0].idx);
+
+	/* the next duty_open compacts instead */
+	if (compact_id != 0)
+		g_source_remove (compact_id);
+	compact_id = 0;
+
+	if (log_fd >= 0)
+		close (log_fd);
+	log_fd = -1;
+}
+
+static gint
+compare_bucket (gconstpointer a, gconstpointer b)
+{
+	const DayBucket *ba = a;
+	const DayBucket *bb = b;
+
+	if (ba->day != bb->day)
+		return ba->day - bb->day;
+	if (ba->idx != bb->idx)
+		return (ba->idx > bb->idx) - (ba->idx < bb->idx);
+	return ba->type - bb->type;
+}
+
+static gchar *
+format_hours (gint64 usec)
+{
+	return g_strdup_printf ("%.2fh", usec / (3600.0 * G_USEC_PER_SEC));
+}
+
+/* --duty-cycle: print per-day, per-device totals, returns the exit status */
+gint
+duty_query (void)
+{
+	DutyRecord *records;
+	DayBucket *bucket;
+	GArray *buckets;
+	GArray *tracks;
+	GError *err = NULL;
+	gchar *h[N_DUTY_STATES];
+	gint64 tracked_usec;
+	gsize n;
+	guint i;
+	guint s;
+
+	init_path ();
+	if (!read_log (&records, &n, &err)) {
+		g_printerr ("No duty-cycle log: %s\n", err->message);
+		g_error_free (err);
+		return 1;
+	}
+
+	buckets = g_array_new (FALSE, FALSE, sizeof (DayBucket));
+	tracks = g_array_new (FALSE, FALSE, sizeof (DeviceTrack));
+	replay (records, n, g_get_real_time (), buckets, tracks);
+	g_array_sort (buckets, compare_bucket);
+
+	g_print ("%-10s %5s %-10s %10s %10s %10s %6s\n",
+		 "day", "index", "type", "unblocked", "soft", "hard", "duty");
+	for (i = 0; i < buckets->len; i++) {
+		bucket = &g_array_index (buckets, DayBucket, i);
+		tracked_usec = 0;
+		for (s = 0; s < N_DUTY_STATES; s++) {
+			h[s] = format_hours (bucket->usec[s]);
+			tracked_usec += bucket->usec[s];
+		}
+		g_print ("%04d-%02d-%02d %5u %-10s %10s %10s %10s %5.1f%%\n",
+			 bucket->day / 10000, bucket->day / 100 % 100, bucket->day % 100,
+			 bucket->idx, rfkill_type_name (bucket->type),
+			 h[DUTY_UNBLOCKED], h[DUTY_SOFT], h[DUTY_HARD],
+			 tracked_usec ? 100.0 * bucket->usec[DUTY_UNBLOCKED] / tracked_usec : 0.0);
+		for (s = 0; s < N_DUTY_STATES; s++)
+			g_free (h[s]);
+	}
+
+	g_array_free (tracks, TRUE);
+	g_array_free (buckets, TRUE);
+	g_free (records);
+
+	return 0;
+}
@@ -0,0 +1,55 @@
+/**
+ * Static tracepoints (USDT) on the scan, toggle, write, event and draw
+ * paths.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * Built in when <sys/sdt.h> is available (systemtap-sdt-dev). Each probe
+ * is a single nop until a tracer attaches, e.g. hotkey to radio latency:
+ *
+ *	bpftrace -e 'usdt:./grfkill:grfkill:write_done { @us[arg1] = hist(arg3); }'
+ *
+ *	scan_start    ()
+ *	scan_done     (n_devices, usec)
+ *	toggle        (idx, type, blocked)
+ *	write_done    (idx, type, blocked, usec)
+ *	event         (idx, type, op, soft, hard)
+ *	draw_start    ()
+ *	draw_done     (width, height, usec)
+ *
+ * The probes have semaphores, which the tracer raises while attached.
+ * Arguments that cost something to compute, the clock reads behind the
+ * usec ones, are only taken under GRFKILL_PROBE_ENABLED (name). Every
+ * probe needs its GRFKILL_PROBE_SEMAPHORE (name) in the file using it.
+ */
+
+#ifndef GRFKILL_PROBES_H
+#define GRFKILL_PROBES_H
+
+#ifdef HAVE_SYS_SDT_H
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+#define GRFKILL_PROBE_SEMAPHORE(name) \
+	__extension__ unsigned short grfkill_##name##_semaphore \
+	__attribute__ ((unused)) __attribute__ ((section (".probes")))
+#define GRFKILL_PROBE_ENABLED(name) \
+	__builtin_expect (*(volatile unsigned short *) &grfkill_##name##_semaphore, 0)
+
+#define GRFKILL_PROBE0(name)                DTRACE_PROBE (grfkill, name)
+#define GRFKILL_PROBE2(name, a, b)          DTRACE_PROBE2 (grfkill, name, a, b)
+#define GRFKILL_PROBE3(name, a, b, c)       DTRACE_PROBE3 (grfkill, name, a, b, c)
+#define GRFKILL_PROBE4(name, a, b, c, d)    DTRACE_PROBE4 (grfkill, name, a, b, c, d)
+#define GRFKILL_PROBE5(name, a, b, c, d, e) DTRACE_PROBE5 (grfkill, name, a, b, c, d, e)
+#else
+#define GRFKILL_PROBE_SEMAPHORE(name)       struct grfkill_##name##_semaphore
+#define GRFKILL_PROBE_ENABLED(name)         0
+/* sizeof keeps the arguments "used" without evaluating them */
+#define GRFKILL_PROBE0(name)                do { } while (0)
+#define GRFKILL_PROBE2(name, a, b)          do { (void) sizeof ((a) + (b)); } while (0)
+#define GRFKILL_PROBE3(name, a, b, c)       do { (void) sizeof ((a) + (b) + (c)); } while (0)
+#define GRFKILL_PROBE4(name, a, b, c, d)    do { (void) sizeof ((a) + (b) + (c) + (d)); } while (0)
+#define GRFKILL_PROBE5(name, a, b, c, d, e) do { (void) sizeof ((a) + (b) + (c) + (d) + (e)); } while (0)
+#endif
+
+#endif /* GRFKILL_PROBES_H */
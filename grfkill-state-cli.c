@@ -0,0 +1,99 @@
+/**
+ * grfkill-state: print the radio table published by a resident grfkill
+ * without touching sysfs or /dev/rfkill.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ *	grfkill-state            list every device, like "rfkill list"
+ *	grfkill-state wlan       only devices of that type
+ *	grfkill-state 3          only the device with that index
+ *	grfkill-state --wakeups  main loop wakeups per source since start
+ *
+ * Exits 1 when no resident grfkill publishes state, 2 when nothing matched.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <linux/rfkill.h>
+
+#include "grfkill-state.h"
+
+static const char *const type_names[NUM_RFKILL_TYPES] = {
+	[RFKILL_TYPE_ALL]       = "all",
+	[RFKILL_TYPE_WLAN]      = "wlan",
+	[RFKILL_TYPE_BLUETOOTH] = "bluetooth",
+	[RFKILL_TYPE_UWB]       = "ultrawideband",
+	[RFKILL_TYPE_WIMAX]     = "wimax",
+	[RFKILL_TYPE_WWAN]      = "wwan",
+	[RFKILL_TYPE_GPS]       = "gps",
+	[RFKILL_TYPE_FM]        = "fm",
+	[RFKILL_TYPE_NFC]       = "nfc",
+};
+
+static const char *
+type_name (unsigned int type)
+{
+	return type < NUM_RFKILL_TYPES ? type_names[type] : "unknown";
+}
+
+static int
+matches (const struct grfkill_state_device *dev, const char *filter)
+{
+	char *end;
+	unsigned long idx;
+
+	if (filter == NULL || strcmp (filter, "all") == 0)
+		return 1;
+
+	idx = strtoul (filter, &end, 10);
+	if (*filter != '\0' && *end == '\0')
+		return dev->idx == idx;
+
+	return strcmp (type_name (dev->type), filter) == 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+	const struct grfkill_state *map;
+	const struct grfkill_state_device *dev;
+	struct grfkill_state snap;
+	const char *filter = argc > 1 ? argv[1] : NULL;
+	int found = 0;
+	uint32_t i;
+
+	map = grfkill_state_map ();
+	if (map == NULL || grfkill_state_snapshot (map, &snap) < 0) {
+		fprintf (stderr, "grfkill-state: no published state: %s\n",
+			 strerror (errno));
+		return 1;
+	}
+
+	if (!grfkill_state_alive (&snap))
+		fprintf (stderr, "grfkill-state: warning: writer is gone, state may be stale\n");
+
+	if (filter != NULL && strcmp (filter, "--wakeups") == 0) {
+		for (i = 0; i < GRFKILL_N_WAKEUPS; i++)
+			printf ("%-8s %llu\n", grfkill_state_wakeup_name (i),
+				(unsigned long long) snap.wakeups[i]);
+		grfkill_state_unmap (map);
+		return 0;
+	}
+
+	for (i = 0; i < snap.n_devices; i++) {
+		dev = &snap.devices[i];
+		if (!matches (dev, filter))
+			continue;
+
+		printf ("%u: %s: %s\n", dev->idx, dev->name, type_name (dev->type));
+		printf ("\tSoft blocked: %s\n", dev->soft ? "yes" : "no");
+		printf ("\tHard blocked: %s\n", dev->hard ? "yes" : "no");
+		found++;
+	}
+
+	grfkill_state_unmap (map);
+
+	return found ? 0 : 2;
+}
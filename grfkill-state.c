@@ -0,0 +1,130 @@
+/**
+ * Reader side of the grfkill state file, see grfkill-state.h.
+ *
+ * Same license as gtk-nodeco.c.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "grfkill-state.h"
+
+#define SNAPSHOT_RETRIES 1000
+
+int
+grfkill_state_path (char *buf, size_t len)
+{
+	const char *dir = getenv ("XDG_RUNTIME_DIR");
+	int n;
+
+	if (dir == NULL || *dir == '\0') {
+		errno = ENOENT;
+		return -1;
+	}
+
+	n = snprintf (buf, len, "%s/%s", dir, GRFKILL_STATE_FILE);
+	if (n < 0 || (size_t) n >= len) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+
+	return 0;
+}
+
+const struct grfkill_state *
+grfkill_state_map (void)
+{
+	char path[4096];
+	void *map;
+	int fd;
+
+	if (grfkill_state_path (path, sizeof (path)) < 0)
+		return NULL;
+
+	fd = open (path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return NULL;
+
+	map = mmap (NULL, sizeof (struct grfkill_state), PROT_READ, MAP_SHARED, fd, 0);
+	close (fd);
+
+	return map == MAP_FAILED ? NULL : map;
+}
+
+void
+grfkill_state_unmap (const struct grfkill_state *map)
+{
+	if (map != NULL)
+		munmap ((void *) map, sizeof (struct grfkill_state));
+}
+
+int
+grfkill_state_snapshot (const struct grfkill_state *map,
+			struct grfkill_state       *out)
+{
+	uint32_t seq1;
+	uint32_t seq2;
+	int tries;
+
+	for (tries = 0; tries < SNAPSHOT_RETRIES; tries++) {
+		seq1 = __atomic_load_n (&map->seq, __ATOMIC_ACQUIRE);
+		if (seq1 & 1) {
+			sched_yield ();
+			continue;
+		}
+
+		memcpy (out, map, sizeof (struct grfkill_state));
+		__atomic_thread_fence (__ATOMIC_ACQUIRE);
+		seq2 = __atomic_load_n (&map->seq, __ATOMIC_RELAXED);
+		if (seq1 != seq2)
+			continue;
+
+		if (out->magic != GRFKILL_STATE_MAGIC ||
+		    out->version != GRFKILL_STATE_VERSION) {
+			errno = EPROTO;
+			return -1;
+		}
+		if (out->n_devices > GRFKILL_STATE_MAX_DEVICES)
+			out->n_devices = GRFKILL_STATE_MAX_DEVICES;
+
+		return 0;
+	}
+
+	errno = EAGAIN;
+	return -1;
+}
+
+static const char *const wakeup_names[GRFKILL_N_WAKEUPS] = {
+	[GRFKILL_WAKEUP_POLL]    = "poll",
+	[GRFKILL_WAKEUP_RFKILL]  = "rfkill",
+	[GRFKILL_WAKEUP_TIMEOUT] = "timeout",
+	[GRFKILL_WAKEUP_METRICS] = "metrics",
+	[GRFKILL_WAKEUP_SIGNAL]  = "signal",
+	[GRFKILL_WAKEUP_DBUS]    = "dbus",
+	[GRFKILL_WAKEUP_CHILD]   = "child",
+	[GRFKILL_WAKEUP_HOTKEY]  = "hotkey",
+	[GRFKILL_WAKEUP_CONFIG]  = "config",
+	[GRFKILL_WAKEUP_POLICY]  = "policy",
+};
+
+const char *
+grfkill_state_wakeup_name (unsigned int source)
+{
+	return source < GRFKILL_N_WAKEUPS ? wakeup_names[source] : "unknown";
+}
+
+int
+grfkill_state_alive (const struct grfkill_state *snapshot)
+{
+	if (snapshot->pid <= 0)
+		return 0;
+
+	return kill (snapshot->pid, 0) == 0 || errno == EPERM;
+}
@@ -0,0 +1,88 @@
+/**
+ * Reader API for the device table published by a resident grfkill.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * grfkill --resident keeps $XDG_RUNTIME_DIR/grfkill.state mapped and
+ * rewrites it under a sequence lock whenever a radio changes. Readers map
+ * it once and take consistent snapshots with plain memory loads:
+ *
+ *	const struct grfkill_state *map = grfkill_state_map ();
+ *	struct grfkill_state snap;
+ *
+ *	if (map && grfkill_state_snapshot (map, &snap) == 0)
+ *		... snap.devices[0 .. snap.n_devices - 1] ...
+ *
+ * This header and grfkill-state.c depend on libc only.
+ */
+
+#ifndef GRFKILL_STATE_H
+#define GRFKILL_STATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#define GRFKILL_STATE_FILE        "grfkill.state"
+#define GRFKILL_STATE_MAGIC       0x6b667267	/* "grfk" */
+#define GRFKILL_STATE_VERSION     2
+#define GRFKILL_STATE_MAX_DEVICES 64
+#define GRFKILL_STATE_NAME_LEN    64
+
+/* wakeup counters, so idle cost can be checked from outside */
+enum grfkill_wakeup {
+	GRFKILL_WAKEUP_POLL,	/* main loop left poll(), whatever woke it */
+	GRFKILL_WAKEUP_RFKILL,	/* /dev/rfkill event */
+	GRFKILL_WAKEUP_TIMEOUT,	/* OSD hide and idle trim */
+	GRFKILL_WAKEUP_METRICS,	/* metrics textfile flush */
+	GRFKILL_WAKEUP_SIGNAL,	/* unix signal handlers */
+	GRFKILL_WAKEUP_DBUS,	/* D-Bus method call */
+	GRFKILL_WAKEUP_CHILD,	/* rfkill(8) fallback exited */
+	GRFKILL_WAKEUP_HOTKEY,	/* grabbed key pressed */
+	GRFKILL_WAKEUP_CONFIG,	/* config file or icon override edited */
+	GRFKILL_WAKEUP_POLICY,	/* policy timer, link, uevent or lid switch */
+	GRFKILL_N_WAKEUPS
+};
+
+#define GRFKILL_STATE_MAX_WAKEUPS 16
+
+struct grfkill_state_device {
+	uint32_t idx;
+	uint8_t  type;		/* RFKILL_TYPE_* from <linux/rfkill.h> */
+	uint8_t  soft;
+	uint8_t  hard;
+	uint8_t  persistent;
+	char     name[GRFKILL_STATE_NAME_LEN];
+};
+
+struct grfkill_state {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t seq;		/* odd while the writer is updating */
+	uint32_t n_devices;
+	int32_t  pid;		/* writer, 0 once it exited cleanly */
+	uint32_t reserved;
+	uint64_t updated_usec;	/* CLOCK_MONOTONIC */
+	struct grfkill_state_device devices[GRFKILL_STATE_MAX_DEVICES];
+	/* updated with atomic adds outside the sequence lock */
+	uint64_t wakeups[GRFKILL_STATE_MAX_WAKEUPS];
+};
+
+/* writes $XDG_RUNTIME_DIR/grfkill.state into buf, -1 if there is none */
+int   grfkill_state_path     (char *buf, size_t len);
+
+/* read-only mapping of the state file, NULL with errno set on failure */
+const struct grfkill_state *grfkill_state_map (void);
+void  grfkill_state_unmap    (const struct grfkill_state *map);
+
+/* consistent copy of the table: 0, or -1 with errno EAGAIN/EPROTO */
+int   grfkill_state_snapshot (const struct grfkill_state *map,
+			      struct grfkill_state       *out);
+
+/* name of a GRFKILL_WAKEUP_* source */
+const char *grfkill_state_wakeup_name (unsigned int source);
+
+/* whether the process that wrote the snapshot is still running */
+int   grfkill_state_alive    (const struct grfkill_state *snapshot);
+
+#endif /* GRFKILL_STATE_H */
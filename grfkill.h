@@ -0,0 +1,265 @@
+/**
+ * Shared declarations for the grfkill modules.
+ *
+ * Same license as gtk-nodeco.c.
+ */
+
+#ifndef GRFKILL_H
+#define GRFKILL_H
+
+#include <glib.h>
+#include <cairo.h>
+#include <linux/rfkill.h>
+
+#define GRFKILL_MAX_DEVICES 64
+#define GRFKILL_NAME_LEN    64
+#define GRFKILL_MAX_SELECTORS 8
+
+/* the switches the OSD shows; devices are sorted into them by selectors */
+enum {
+	GRFKILL_CLASS_WLAN,
+	GRFKILL_CLASS_BT,
+	GRFKILL_N_CLASSES
+};
+
+/* the OSD's icon masks, each replaceable in the config file */
+enum {
+	GRFKILL_ICON_BT,
+	GRFKILL_ICON_WLAN,
+	GRFKILL_ICON_WWAN,
+	GRFKILL_ICON_CLOSE,
+	GRFKILL_N_ICONS
+};
+
+typedef struct {
+	guint32 idx;
+	guint8  type;		/* RFKILL_TYPE_* */
+	guint8  soft;
+	guint8  hard;
+	guint8  persistent;
+	guint8  state;		/* RFKILL_STATE_* as reported by sysfs */
+	guint8  classes;	/* GRFKILL_CLASS_* bits, cached when scanned */
+	gchar   name[GRFKILL_NAME_LEN];
+} RfkillDevice;
+
+/* compiled form of the --wlan/--bluetooth selectors */
+typedef struct {
+	guint32       type_mask;	/* bit per RFKILL_TYPE_* */
+	guint         n_indices;
+	guint32       indices[GRFKILL_MAX_SELECTORS];
+	guint         n_names;
+	GPatternSpec *names[GRFKILL_MAX_SELECTORS];
+} RfkillMatcher;
+
+/* rfkill-sysfs.c */
+const gchar *rfkill_type_name      (guint type);
+guint        rfkill_type_from_name (const gchar *name);
+gint         rfkill_sysfs_scan     (RfkillDevice *devices,
+				    guint         max_devices);
+
+/* rfkill-select.c */
+gboolean     rfkill_matcher_compile (RfkillMatcher       *matcher,
+				     gchar              **selectors,
+				     GError             **error);
+void         rfkill_matcher_clear   (RfkillMatcher       *matcher);
+gboolean     rfkill_matcher_match   (const RfkillMatcher *matcher,
+				     const RfkillDevice  *dev);
+
+/* rfkill-event.c */
+typedef void (*RfkillEventFunc) (const struct rfkill_event *event,
+				 gpointer                   user_data);
+
+gboolean     rfkill_event_watch     (RfkillEventFunc      func,
+				     gpointer             user_data);
+gboolean     rfkill_event_watching  (void);
+gint         rfkill_event_write     (guint32              idx,
+				     gboolean             blocked);
+
+/* audit.c */
+enum {
+	AUDIT_OSD,
+	AUDIT_DBUS,
+	AUDIT_EXTERNAL,
+	AUDIT_HOTKEY,
+	AUDIT_POLICY,
+	AUDIT_CLI,		/* written by rfkill(8), for lack of /dev/rfkill */
+	N_AUDIT_INITIATORS
+};
+
+void         audit_open             (void);
+void         audit_request          (guint8              initiator,
+				     const RfkillDevice *dev,
+				     gboolean            blocked,
+				     gint                error);
+void         audit_change           (const RfkillDevice *dev,
+				     gboolean            old_soft,
+				     gboolean            old_hard);
+void         audit_flush            (void);
+void         audit_close            (void);
+
+/* config.c */
+#define CONFIG_MAX_PROFILES 16
+#define CONFIG_MAX_RULES    16
+
+enum {
+	PROFILE_KEEP,
+	PROFILE_BLOCK,
+	PROFILE_UNBLOCK
+};
+
+typedef struct {
+	gchar  name[GRFKILL_NAME_LEN];
+	guint8 state[NUM_RFKILL_TYPES];	/* PROFILE_* per type, [RFKILL_TYPE_ALL] for the rest */
+} RfkillProfile;
+
+/* what makes a rule fire, see policy.c */
+enum {
+	RULE_STATE,		/* every radio of type is (un)blocked */
+	RULE_CONNECTED,		/* a wireless interface is up */
+	RULE_IDLE,		/* bluetooth unblocked with no connection for seconds */
+	RULE_LID,		/* the lid is closed */
+	RULE_AT			/* daily at seconds after local midnight */
+};
+
+enum {
+	RULE_BLOCK,
+	RULE_UNBLOCK,
+	RULE_PROFILE
+};
+
+typedef struct {
+	gchar   name[GRFKILL_NAME_LEN];
+	guint8  trigger;	/* RULE_STATE .. RULE_AT */
+	guint8  type;		/* RFKILL_TYPE_* the trigger looks at */
+	guint8  blocked;	/* RULE_STATE: the state it waits for */
+	guint32 seconds;	/* RULE_IDLE, RULE_AT */
+	guint8  action;		/* RULE_BLOCK, RULE_UNBLOCK, RULE_PROFILE */
+	guint8  action_type;	/* RFKILL_TYPE_* to (un)block, ALL for every radio */
+	gchar   profile[GRFKILL_NAME_LEN];
+} PolicyRule;
+
+typedef struct {
+	gchar         **selectors[GRFKILL_N_CLASSES];	/* NULL where the file has none */
+	gchar          *icons[GRFKILL_N_ICONS];	/* SVG paths, NULL for the built-in */
+	RfkillProfile   profiles[CONFIG_MAX_PROFILES];
+	guint           n_profiles;
+	PolicyRule      rules[CONFIG_MAX_RULES];
+	guint           n_rules;
+} GrfkillConfig;
+
+#define CONFIG_CHANGED_SELECTORS(class) (1 << (class))
+#define CONFIG_CHANGED_PROFILES         (1 << GRFKILL_N_CLASSES)
+#define CONFIG_CHANGED_ICONS            (1 << (GRFKILL_N_CLASSES + 1))
+#define CONFIG_CHANGED_RULES            (1 << (GRFKILL_N_CLASSES + 2))
+
+/* changed is CONFIG_CHANGED_* bits, icons_changed one bit per GRFKILL_ICON_* */
+typedef void (*ConfigChangedFunc) (const GrfkillConfig *config,
+				   guint                changed,
+				   guint                icons_changed);
+
+const GrfkillConfig *config_open    (const gchar         *path);
+void         config_watch           (ConfigChangedFunc    func);
+const RfkillProfile *config_profile (const gchar         *name);
+guint        config_profile_state   (const RfkillProfile *profile,
+				     guint8               type);
+
+/* dutycycle.c */
+void         duty_open              (void);
+void         duty_record            (const RfkillDevice *dev);
+void         duty_record_gone       (guint32             idx);
+void         duty_close             (void);
+gint         duty_query             (void);
+
+/* hotkeys.c */
+#define HOTKEY_MAX 16
+
+enum {
+	HOTKEY_WLAN,
+	HOTKEY_BLUETOOTH,
+	HOTKEY_ALL,
+	N_HOTKEY_ACTIONS
+};
+
+typedef void (*HotkeyFunc) (guint action);
+
+gboolean     hotkeys_bind           (gchar              **bindings,
+				     HotkeyFunc           func,
+				     GError             **error);
+
+/* icon-cache.c */
+cairo_surface_t *icon_cache_load    (const gchar         *name,
+				     const gchar         *path,
+				     gint                 width,
+				     gint                 height,
+				     gint                 scale);
+gsize        icon_cache_svg_size    (const gchar         *name);
+
+/* mem-report.c */
+gint         mem_report             (void);
+gboolean     mem_budget             (gsize                icon_bytes,
+				     gsize                raster_bytes,
+				     gint                 budget_kb);
+
+/* metrics.c */
+void         metrics_init           (const gchar        *path);
+void         metrics_write          (guint8              type,
+				     gboolean            ok);
+void         metrics_event          (guint8              op);
+void         metrics_startup        (gint64              usec);
+void         metrics_repaint        (void);
+void         metrics_fade           (guint               frames,
+				     guint               repainted);
+void         metrics_device         (const RfkillDevice *dev);
+void         metrics_device_gone    (guint32             idx);
+void         metrics_sync           (void);
+
+/* policy.c */
+typedef struct {
+	guint32  idx;
+	gboolean blocked;
+} PolicyWrite;
+
+/* one evaluation pass worth of changes, devices already in place left out */
+typedef void (*PolicyApplyFunc) (const PolicyWrite *writes,
+				 guint              n_writes);
+
+void         policy_start           (const RfkillDevice  *devices,
+				     const guint         *n_devices,
+				     PolicyApplyFunc      apply);
+void         policy_load            (const GrfkillConfig *config);
+void         policy_radio_changed   (void);
+
+/* rfkill-dbus.c */
+
+/* 0, -ENODEV for no such device, -ERFKILL if hard blocked, else -errno */
+typedef gint (*RfkillSetBlockFunc) (guint32  idx,
+				    gboolean blocked);
+
+void         rfkill_dbus_start      (const RfkillDevice  *devices,
+				     const guint         *n_devices,
+				     RfkillSetBlockFunc   set_block);
+void         rfkill_dbus_device_changed  (const RfkillDevice *dev);
+void         rfkill_dbus_devices_changed (void);
+
+/* rfkill-shm.c */
+gint         rfkill_shm_open        (void);
+void         rfkill_shm_publish     (const RfkillDevice  *devices,
+				     guint                n_devices);
+void         rfkill_shm_wakeup      (guint                source);
+void         rfkill_shm_close       (void);
+
+/* toggle-latency.c */
+void         latency_toggle_start   (guint32 idx,
+				     guint8  type);
+void         latency_write_issued   (guint32 idx);
+void         latency_write_done     (guint32 idx);
+void         latency_event          (guint32  idx,
+				     gboolean painting);
+void         latency_frame          (void);
+void         latency_report         (void);
+
+/* x11-trace.c */
+gboolean     x11_trace_counts       (guint64             *requests,
+				     guint               *trips);
+
+#endif /* GRFKILL_H */
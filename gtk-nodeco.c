@@ -24,21 +24,38 @@
  */
 
 #include <gtk/gtk.h>
-#include <gdk-pixbuf/gdk-pixdata.h>
+#include <gdk/gdkx.h>
+#include <glib-unix.h>
+#include <signal.h>
+#include <errno.h>
 #include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+#include "grfkill-probes.h"
+
+/* raised by a tracer while it is attached, see grfkill-probes.h */
+GRFKILL_PROBE_SEMAPHORE (scan_start);
+GRFKILL_PROBE_SEMAPHORE (scan_done);
+GRFKILL_PROBE_SEMAPHORE (toggle);
+GRFKILL_PROBE_SEMAPHORE (write_done);
+GRFKILL_PROBE_SEMAPHORE (event);
+GRFKILL_PROBE_SEMAPHORE (draw_start);
+GRFKILL_PROBE_SEMAPHORE (draw_done);
 
 #define BACKGROUND_ALPHA 0.75
 #define ICON_SAPCE 6
-#define ICON_SIZE 96
-
-#include "bt-blocked.h"
-#include "bt-unblocked.h"
-#include "close.h"
-#include "close-red.h"
-#include "wlan-blocked.h"
-#include "wlan-unblocked.h"
-#include "wwan-blocked.h"
-#include "wwan-unblocked.h"
+#define OSD_SLOTS 3		/* device columns per page */
+#define OSD_BORDER 12		/* plus the theme's window padding */
+#define OSD_ROW_SPACING 10
+#define OSD_COL_SPACING 5
+#define FADE_IN_USEC  (120 * 1000)
+#define FADE_OUT_USEC (180 * 1000)
 
 #define DEFAULT_WLAN "wlan"
 #define DEFAULT_BT   "bluetooth"
@@ -47,25 +64,147 @@ static gchar css_data[] = "GtkWindow {\
     border-radius: 5;\
 	}";
 
-static gboolean wwan_state = TRUE;
-static gboolean bt_state = TRUE;
-static gboolean wlan_state = TRUE;
-static gint64 wwan_index = 0;
-static gint64 bt_index = 0;
-static gint64 wlan_index = 0;
+static gint64 bt_index = -1;		/* hotkey targets, -1 while nothing matches */
+static gint64 wlan_index = -1;
 static gboolean initialized = FALSE;
-
-static GdkPixbuf *bt_blocked_pb;
-static GdkPixbuf *bt_unblocked_pb;
-static GdkPixbuf *close_icon_pb;
-static GdkPixbuf *close_red_pb;
-static GdkPixbuf *wlan_blocked_pb;
-static GdkPixbuf *wlan_unblocked_pb;
-static GdkPixbuf *wwan_blocked_pb;
-static GdkPixbuf *wwan_unblocked_pb;
-
-static gchar *wlan_device = NULL;
-static gchar *bt_device   = NULL;
+static gboolean syncing = FALSE;
+static gboolean resident = FALSE;
+static gboolean latency = FALSE;
+static guint8 initiator = AUDIT_OSD;	/* who the switch callbacks act for */
+static gint write_error = 0;		/* of the last rfkill_set_block */
+static gchar *metrics_file = NULL;
+static gboolean duty_cycle = FALSE;
+static gint idle_trim = 300;		/* seconds hidden before the OSD is dropped */
+static gboolean memory_report = FALSE;
+static gint memory_budget = -1;		/* kB, 0 only reports */
+static gint exit_status = 0;
+static gchar **hotkey_bindings = NULL;
+static gboolean fast_theme = FALSE;
+static gchar *render_png = NULL;
+static gchar *render_state = NULL;
+static gint render_scale = 1;
+static gint render_bench = 0;
+static gchar *render_golden = NULL;
+static gint alloc_check = 0;
+static gboolean offscreen = FALSE;	/* build_osd makes a GtkOffscreenWindow */
+
+static RfkillDevice devices[GRFKILL_MAX_DEVICES];
+static guint n_devices = 0;
+
+/*
+ * The OSD has a fixed pool of OSD_SLOTS icon/switch columns. Shown
+ * devices are ordered by type and cut into pages; the slots are
+ * rebound to the current page, so widget count and frame cost do not
+ * grow with the number of radios.
+ */
+typedef struct {
+	GtkWidget *icon;
+	GtkWidget *sw;
+	guint32    idx;
+	gboolean   bound;
+	guint      glyph;	/* ICON_* mask the icon draws */
+	gboolean   active;	/* which badge it draws */
+} OsdSlot;
+
+static OsdSlot slots[OSD_SLOTS];
+static guint32 shown[GRFKILL_MAX_DEVICES];	/* indices in display order */
+static guint n_shown = 0;
+static guint page_start[GRFKILL_MAX_DEVICES + 1];
+static guint n_pages = 0;
+static guint page = 0;
+
+/*
+ * One alpha mask per glyph, tinted with theme colours when drawn. The
+ * blocked/unblocked badge is a path on top, so both states and every
+ * theme share the same mask.
+ */
+enum {
+	ICON_BT    = GRFKILL_ICON_BT,
+	ICON_WLAN  = GRFKILL_ICON_WLAN,
+	ICON_WWAN  = GRFKILL_ICON_WWAN,
+	ICON_CLOSE = GRFKILL_ICON_CLOSE,
+	N_ICONS    = GRFKILL_N_ICONS
+};
+
+/* the SVG in the resources and its size in logical pixels */
+static const struct {
+	const gchar *name;
+	gint         size;
+} icon_sources[N_ICONS] = {
+	[ICON_BT]    = { "bt-icon",   128 },
+	[ICON_WLAN]  = { "wlan-icon", 128 },
+	[ICON_WWAN]  = { "wwan-icon", 128 },
+	[ICON_CLOSE] = { "close",     16 },
+};
+
+/* the badges of the old blocked and unblocked art, on a 128 grid */
+#define BADGE_GRID 128.0
+
+static const gdouble badge_on[] = {
+	80.0, 23.75,  100.7, 34.6,  128.0, 0.0,  104.05, 48.0
+};
+
+static const gdouble badge_off[] = {
+	86.25, 0.0,  80.0, 6.25,  97.75, 24.0,  80.0, 41.75,  86.25, 48.0,
+	103.0, 30.25,  121.75, 48.0,  128.0, 41.75,  110.25, 24.0,
+	128.0, 6.25,  121.75, 0.0,  104.0, 17.75
+};
+
+typedef struct {
+	GdkRGBA fg;	/* glyphs and the close icon */
+	GdkRGBA on;	/* unblocked badge */
+	GdkRGBA off;	/* blocked badge, close icon under the pointer */
+} IconColors;
+
+/* the colours of the old art, for themes without success/error colours */
+static const IconColors default_colors = {
+	{ 0xee / 255.0, 0xee / 255.0, 0xec / 255.0, 1.0 },
+	{ 0x00 / 255.0, 0x80 / 255.0, 0x00 / 255.0, 1.0 },
+	{ 0xc8 / 255.0, 0x37 / 255.0, 0x37 / 255.0, 1.0 },
+};
+
+/* A8 image surfaces with the device scale set, icon_scale device pixels per pixel */
+static cairo_surface_t *icons[N_ICONS];
+static gint icon_scale = 1;
+
+static gchar **wlan_selectors = NULL;
+static gchar **bt_selectors   = NULL;
+static gchar *config_file = NULL;
+static const GrfkillConfig *config = NULL;
+static RfkillMatcher matchers[GRFKILL_N_CLASSES];
+
+static GtkCssProvider *css_provider = NULL;
+static GtkWidget *osd_window = NULL;
+static GtkWidget *page_label = NULL;
+
+/* no compositor: the corners come from a shape mask and fills are opaque */
+static gboolean opaque = FALSE;
+static cairo_region_t *shape_region = NULL;
+static gint shape_width = 0;
+static gint shape_height = 0;
+static guint hide_timeout_id = 0;
+
+/* fades change the window opacity only, the compositor does the blending */
+static guint fade_tick_id = 0;
+static gint64 fade_start;
+static gint64 fade_usec;
+static gdouble fade_from;
+static gdouble fade_to;
+static gdouble fade_opacity = 1.0;
+static guint fade_frames;
+static guint64 repaints = 0;	/* draw_widget calls */
+static guint64 fade_repaints_start;
+static guint trim_timeout_id = 0;
+static GPollFunc default_poll = NULL;
+
+/* startup profiler, enabled by setting GRFKILL_PROFILE in the environment */
+static gboolean profile_enabled = FALSE;
+static gint64 profile_start;
+static gint64 profile_last;
+static guint64 profile_requests;
+static guint profile_trips;
+static gint64 probe_usec;
+static gboolean startup_pending = TRUE;
 
 draw_rounded_rectangle (cairo_t *cr,
 			gdouble  aspect,
@@ -118,6 +257,84 @@ draw_rounded_rectangle (cairo_t *cr,
 	cairo_close_path (cr);
 }
 
+static void
+profile_init (void)
+{
+	profile_enabled = g_getenv ("GRFKILL_PROFILE") != NULL;
+	profile_start = profile_last = g_get_monotonic_time ();
+}
+
+static void
+profile_mark (const gchar *phase)
+{
+	gint64 now;
+	guint64 requests;
+	guint trips;
+	gboolean counted;
+
+	if (!profile_enabled)
+		return;
+
+	now = g_get_monotonic_time ();
+	counted = x11_trace_counts (&requests, &trips);
+	g_printerr ("grfkill: %-14s %8.3f ms  (+%.3f ms)  +%" G_GUINT64_FORMAT " X requests",
+		    phase,
+		    (now - profile_start) / 1000.0,
+		    (now - profile_last) / 1000.0,
+		    requests - profile_requests);
+	/* only a "make PROFILE=1" build counts them */
+	if (counted)
+		g_printerr (", +%u round trips", trips - profile_trips);
+	g_printerr ("\n");
+	profile_last = now;
+	profile_requests = requests;
+	profile_trips = trips;
+}
+
+/* translucent with rounded corners, or opaque inside the shape mask */
+static void
+paint_background (cairo_t *cr, int width, int height, GdkRGBA acolor)
+{
+	cairo_set_operator (cr, CAIRO_OPERATOR_SOURCE);
+
+	if (opaque) {
+		/* the shape mask already cut the corners */
+		acolor.alpha = 1.0;
+		gdk_cairo_set_source_rgba (cr, &acolor);
+		cairo_paint (cr);
+	} else {
+		cairo_set_source_rgba (cr, 1.0, 1.0, 1.0, 0.0);
+		cairo_paint (cr);
+
+		draw_rounded_rectangle (cr, 1.0, 0.0, 0.0, height/10, width-1, height-1);
+		acolor.alpha = BACKGROUND_ALPHA;
+		gdk_cairo_set_source_rgba (cr, &acolor);
+		cairo_fill(cr);
+	}
+}
+
+/* measure once the OSD is on screen, then quit with the verdict */
+static gboolean
+memory_budget_cb (gpointer data)
+{
+	gsize icon_bytes = 0;
+	gsize raster_bytes = 0;
+	guint i;
+
+	for (i = 0; i < N_ICONS; i++) {
+		icon_bytes += icon_cache_svg_size (icon_sources[i].name);
+		if (icons[i])
+			raster_bytes += (gsize) cairo_image_surface_get_stride (icons[i]) *
+					cairo_image_surface_get_height (icons[i]);
+	}
+
+	if (!mem_budget (icon_bytes, raster_bytes, memory_budget))
+		exit_status = 1;
+	gtk_main_quit ();
+
+	return G_SOURCE_REMOVE;
+}
+
 static gboolean
 draw_widget (GtkWidget *window,
 	     cairo_t   *cr,
@@ -127,36 +344,119 @@ draw_widget (GtkWidget *window,
 	GdkRGBA		 acolor;
 	int		 width;
 	int		 height;
+	gint64		 start = GRFKILL_PROBE_ENABLED (draw_done) ? g_get_monotonic_time () : 0;
+
+	GRFKILL_PROBE0 (draw_start);
 
 	context = gtk_widget_get_style_context (window);
 
-	cairo_set_operator (cr, CAIRO_OPERATOR_SOURCE);
 	gtk_window_get_size (GTK_WINDOW (window), &width, &height);
-
-	cairo_set_source_rgba (cr, 1.0, 1.0, 1.0, 0.0);
-	cairo_paint (cr);
-
-	draw_rounded_rectangle (cr, 1.0, 0.0, 0.0, height/10, width-1, height-1);
 	gtk_style_context_get_background_color (context, GTK_STATE_NORMAL, &acolor);
-	acolor.alpha = BACKGROUND_ALPHA;
-	gdk_cairo_set_source_rgba (cr, &acolor);
-	cairo_fill(cr);
+	paint_background (cr, width, height, acolor);
+
+	if (GRFKILL_PROBE_ENABLED (draw_done) && start)
+		GRFKILL_PROBE3 (draw_done, width, height, g_get_monotonic_time () - start);
+	latency_frame ();
+	repaints++;
+	metrics_repaint ();
+
+	if (startup_pending) {
+		metrics_startup (g_get_monotonic_time () - profile_start);
+		if (memory_budget >= 0)
+			g_idle_add (memory_budget_cb, NULL);
+		startup_pending = FALSE;
+	}
+
+	if (profile_enabled) {
+		profile_mark ("first frame");
+		profile_enabled = FALSE;
+	}
 
 	return FALSE;
 }
 
+/* the rounded-corner mask is only rebuilt when the size changes */
+static void
+update_shape (GtkWidget *window, gint width, gint height)
+{
+	cairo_surface_t *mask;
+	cairo_t *cr;
+
+	if (!opaque) {
+		if (shape_region) {
+			gtk_widget_shape_combine_region (window, NULL);
+			g_clear_pointer (&shape_region, cairo_region_destroy);
+		}
+		return;
+	}
+
+	if (shape_region && width == shape_width && height == shape_height)
+		return;
+
+	mask = cairo_image_surface_create (CAIRO_FORMAT_A1, width, height);
+	cr = cairo_create (mask);
+	draw_rounded_rectangle (cr, 1.0, 0.0, 0.0, height/10, width, height);
+	cairo_fill (cr);
+	cairo_destroy (cr);
+
+	if (shape_region)
+		cairo_region_destroy (shape_region);
+	shape_region = gdk_cairo_region_create_from_surface (mask);
+	cairo_surface_destroy (mask);
+
+	shape_width = width;
+	shape_height = height;
+	gtk_widget_shape_combine_region (window, shape_region);
+}
+
+static void
+size_allocate_cb (GtkWidget     *window,
+		  GtkAllocation *allocation,
+		  gpointer       user_data)
+{
+	update_shape (window, allocation->width, allocation->height);
+}
+
+/* translucency needs both an RGBA visual and a compositor to blend it */
+static void
+update_opaque (GtkWidget *window)
+{
+	GdkScreen *screen = gtk_widget_get_screen (window);
+
+	opaque = !gdk_screen_is_composited (screen) ||
+		 gtk_widget_get_visual (window) != gdk_screen_get_rgba_visual (screen);
+	shape_width = shape_height = 0;
+	if (gtk_widget_get_realized (window))
+		update_shape (window,
+			      gtk_widget_get_allocated_width (window),
+			      gtk_widget_get_allocated_height (window));
+}
+
+static void
+composited_changed_cb (GdkScreen *screen,
+		       GtkWidget *window)
+{
+	update_opaque (window);
+	gtk_widget_queue_draw (window);
+}
+
 static void
 set_visual (GtkWidget *widget)
 {
 	GdkScreen *screen;
-	GdkVisual *visual;
+	GdkVisual *visual = NULL;
 
 	screen = gtk_widget_get_screen (widget);
-	visual = gdk_screen_get_rgba_visual (screen);
+	/* without a compositor an RGBA visual only costs blending */
+	if (gdk_screen_is_composited (screen))
+		visual = gdk_screen_get_rgba_visual (screen);
 	if (visual == NULL)
 		visual = gdk_screen_get_system_visual (screen);
 
 	gtk_widget_set_visual (widget, visual);
+	update_opaque (widget);
+	g_signal_connect_object (screen, "composited-changed",
+				 G_CALLBACK (composited_changed_cb), widget, 0);
 }
 
 static void
@@ -164,92 +464,265 @@ screen_change_cb (GtkWidget *widget,
 		  GdkScreen *previous_screen,
 		  gpointer   user_data)
 {
+	if (previous_screen)
+		g_signal_handlers_disconnect_by_func (previous_screen,
+						      composited_changed_cb, widget);
 	set_visual (widget);
 }
 
-static void
-load_pixbuf (GtkImage   *icon,
-	     const gchar *icon_name)
+static RfkillDevice *
+find_device (guint32 idx)
 {
-	GtkIconTheme *icon_theme;
-	GdkPixbuf *pixbuf;
+	RfkillDevice *dev;
 
-	/* g_print ("button pressed %s\n", icon_name); */
+	for (dev = devices; dev < devices + n_devices; dev++)
+		if (dev->idx == idx)
+			return dev;
+
+	return NULL;
+}
 
-	icon_theme = gtk_icon_theme_new ();
-	gtk_icon_theme_prepend_search_path (icon_theme, ".");
+static guint8
+device_type (guint32 idx)
+{
+	RfkillDevice *dev = find_device (idx);
 
-	pixbuf = gtk_icon_theme_load_icon (icon_theme,
-					   icon_name,
-					   ICON_SIZE,
-					   0,
-					   NULL);
-	gtk_image_set_from_pixbuf (icon, pixbuf);
-	g_object_unref (icon_theme);
+	return dev ? dev->type : RFKILL_TYPE_ALL;
 }
 
-static gboolean
-switch_activate_cb (GtkSwitch *gtk_switch,
-					GtkImage *gtk_icon,
-					char *name)
+typedef struct {
+	guint32  idx;
+	gboolean blocked;
+} SpawnedWrite;
+
+static void
+spawn_done_cb (GPid pid, gint status, gpointer data)
 {
-	if (gtk_switch_get_active (gtk_switch)){
-		load_pixbuf (gtk_icon, g_strconcat(name, "-unblocked",NULL));
-		return FALSE;
+	SpawnedWrite *spawned = data;
+	RfkillDevice *dev = find_device (spawned->idx);
+	gboolean ok = g_spawn_check_exit_status (status, NULL);
+
+	if (dev != NULL) {
+		metrics_write (dev->type, ok);
+		if (!ok)
+			audit_request (AUDIT_CLI, dev, spawned->blocked, EIO);
+	}
+
+	/* rfkill(8) has written by now, whether or not its event is in */
+	latency_write_done (spawned->idx);
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_CHILD);
+	g_spawn_close_pid (pid);
+	g_free (spawned);
+}
+
+/* no writable /dev/rfkill: let rfkill(8) do it, without waiting for it;
+ * the audit log then shows the write as the CLI's */
+static gint
+rfkill_spawn_block (RfkillDevice *dev, gboolean blocked)
+{
+	gchar index[16];
+	gchar *argv[] = { "rfkill", blocked ? "block" : "unblock", index, NULL };
+	SpawnedWrite *spawned;
+	GError *err = NULL;
+	GPid pid;
+
+	g_snprintf (index, sizeof (index), "%u", dev->idx);
+	if (!g_spawn_async (NULL, argv, NULL,
+			    G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD |
+			    G_SPAWN_STDOUT_TO_DEV_NULL,
+			    NULL, NULL, &pid, &err)) {
+		metrics_write (dev->type, FALSE);
+		audit_request (AUDIT_CLI, dev, blocked, ENOENT);
+		g_error_free (err);
+		return -ENOENT;
 	}
-	else {
-		load_pixbuf (gtk_icon, g_strconcat(name, "-blocked",NULL));
-		return TRUE;
+
+	spawned = g_new0 (SpawnedWrite, 1);
+	spawned->idx = dev->idx;
+	spawned->blocked = blocked;
+	g_child_watch_add (pid, spawn_done_cb, spawned);
+
+	audit_request (AUDIT_CLI, dev, blocked, 0);
+	return 0;
+}
+
+/* 0 or -errno, also left in write_error for writes made through a switch */
+static gint
+rfkill_set_block (guint32 idx, gboolean blocked)
+{
+	RfkillDevice *dev = find_device (idx);
+	gint64 start = GRFKILL_PROBE_ENABLED (write_done) ? g_get_monotonic_time () : 0;
+	gint err;
+
+	if (dev == NULL)
+		return write_error = -ENODEV;
+
+	latency_write_issued (idx);
+	err = rfkill_event_write (idx, blocked);
+	if (err == -EBADF) {
+		/* rfkill(8) reports later, to the audit log */
+		err = rfkill_spawn_block (dev, blocked);
+	} else {
+		metrics_write (dev->type, err == 0);
+		audit_request (initiator, dev, blocked, -err);
+		latency_write_done (idx);
 	}
+
+	if (GRFKILL_PROBE_ENABLED (write_done) && start)
+		GRFKILL_PROBE4 (write_done, idx, dev->type, blocked,
+				g_get_monotonic_time () - start);
+
+	return write_error = err;
 }
 
+/* icons follow the device type, then the class it was selected for */
+static guint
+device_glyph (const RfkillDevice *dev)
+{
+	if (dev->type == RFKILL_TYPE_WWAN)
+		return ICON_WWAN;
+	if (dev->type == RFKILL_TYPE_BLUETOOTH ||
+	    (dev->type != RFKILL_TYPE_WLAN &&
+	     !(dev->classes & (1 << GRFKILL_CLASS_WLAN))))
+		return ICON_BT;
+	return ICON_WLAN;
+}
+
+/* the theme's foreground, success and error colours, where it has them */
 static void
-wlan_switch_activate_cb (GtkSwitch *g_switch,
-			 gboolean   active,
-			 GtkImage  *icon)
+icon_colors (GtkWidget *widget, IconColors *colors)
 {
-	gboolean blocked;
-	gchar index[UCHAR_MAX];
-	blocked = switch_activate_cb (g_switch, icon, "wlan");
-	if (gtk_switch_get_active (g_switch))
-		gtk_image_set_from_pixbuf(icon, wlan_unblocked_pb);
-	else
-		gtk_image_set_from_pixbuf(icon, wlan_blocked_pb);
+	GtkStyleContext *context = gtk_widget_get_style_context (widget);
+	GdkRGBA color;
+
+	*colors = default_colors;
+	gtk_style_context_get_color (context, gtk_style_context_get_state (context),
+				     &colors->fg);
+	if (gtk_style_context_lookup_color (context, "success_color", &color))
+		colors->on = color;
+	if (gtk_style_context_lookup_color (context, "error_color", &color))
+		colors->off = color;
+}
+
+static void
+paint_mask (cairo_t *cr, guint glyph, const GdkRGBA *color, gdouble x, gdouble y)
+{
+	if (icons[glyph] == NULL)
+		return;
+
+	gdk_cairo_set_source_rgba (cr, color);
+	cairo_mask_surface (cr, icons[glyph], x, y);
+}
+
+/* the glyph, with the blocked or unblocked badge on top */
+static void
+paint_device_icon (cairo_t          *cr,
+		   guint             glyph,
+		   gboolean          active,
+		   const IconColors *colors,
+		   gdouble           x,
+		   gdouble           y)
+{
+	const gdouble *badge = active ? badge_on : badge_off;
+	guint n = active ? G_N_ELEMENTS (badge_on) : G_N_ELEMENTS (badge_off);
+	guint i;
+
+	paint_mask (cr, glyph, &colors->fg, x, y);
+
+	cairo_save (cr);
+	cairo_translate (cr, x, y);
+	cairo_scale (cr, icon_sources[glyph].size / BADGE_GRID,
+		     icon_sources[glyph].size / BADGE_GRID);
+	cairo_move_to (cr, badge[0], badge[1]);
+	for (i = 2; i < n; i += 2)
+		cairo_line_to (cr, badge[i], badge[i + 1]);
+	cairo_close_path (cr);
+	gdk_cairo_set_source_rgba (cr, active ? &colors->on : &colors->off);
+	cairo_fill (cr);
+	cairo_restore (cr);
+}
 
-	if(initialized /* if we don't do this rfkill is gonna toggle on startup */){
-		g_ascii_dtostr(index, UCHAR_MAX, wlan_index);
-		system(g_strconcat("rfkill ", blocked ? "block " : "unblock ", index, NULL));
+static gboolean
+slot_draw_cb (GtkWidget *widget,
+	      cairo_t   *cr,
+	      OsdSlot   *slot)
+{
+	IconColors colors;
+
+	icon_colors (widget, &colors);
+	paint_device_icon (cr, slot->glyph, slot->active, &colors,
+			   (gtk_widget_get_allocated_width (widget) - icon_sources[slot->glyph].size) / 2,
+			   (gtk_widget_get_allocated_height (widget) - icon_sources[slot->glyph].size) / 2);
+
+	return TRUE;
+}
+
+/* only redraws when the glyph or badge changes, a toggle allocates nothing */
+static void
+slot_set_icon (OsdSlot *slot, const RfkillDevice *dev, gboolean active)
+{
+	guint glyph = device_glyph (dev);
+
+	if (slot->glyph != glyph || slot->active != active) {
+		slot->glyph = glyph;
+		slot->active = active;
+		gtk_widget_queue_draw (slot->icon);
 	}
 }
 
+/* what a switch flip does past GTK; --alloc-check drives it directly */
 static void
-bt_switch_activate_cb (GtkSwitch *g_switch,
-		       gboolean   active,
-		       GtkImage  *icon)
+slot_toggle (OsdSlot *slot, gboolean blocked)
 {
-	gboolean blocked;
-	gchar index[UCHAR_MAX];
-	blocked = switch_activate_cb (g_switch, icon, "bt");
+	RfkillDevice *dev = find_device (slot->idx);
 
-	if (gtk_switch_get_active (g_switch))
-		gtk_image_set_from_pixbuf(icon, bt_unblocked_pb);
-	else
-		gtk_image_set_from_pixbuf(icon, bt_blocked_pb);
+	if (!slot->bound || dev == NULL)
+		return;
 
-	if(initialized /* if we don't do this rfkill is gonna toggle on startup */){
-		g_ascii_dtostr(index, UCHAR_MAX, bt_index);
-		system(g_strconcat("rfkill ", blocked ? "block " : "unblock ", index, NULL));
+	slot_set_icon (slot, dev, !blocked);
+
+	if(initialized /* if we don't do this rfkill is gonna toggle on startup */
+	   && !syncing /* nor when the switch follows a kernel event */){
+		GRFKILL_PROBE3 (toggle, slot->idx, dev->type, blocked);
+		latency_toggle_start (slot->idx, dev->type);
+		rfkill_set_block (slot->idx, blocked);
 	}
 }
 
 static void
-wwan_switch_activate_cb (GtkSwitch *g_switch,
-			 gboolean   active,
-			 GtkImage  *icon)
+slot_switch_cb (GtkSwitch  *g_switch,
+		GParamSpec *pspec,
+		OsdSlot    *slot)
+{
+	slot_toggle (slot, !gtk_switch_get_active (g_switch));
+}
+
+static OsdSlot *
+find_slot (guint32 idx)
 {
-	switch_activate_cb (g_switch, icon, "wwan");
+	guint i;
+
+	for (i = 0; i < OSD_SLOTS; i++)
+		if (slots[i].bound && slots[i].idx == idx)
+			return &slots[i];
+
+	return NULL;
+}
+
+/* queues the frame that shows idx's new state, FALSE if none will come */
+static gboolean
+queue_slot_frame (guint32 idx)
+{
+	OsdSlot *slot = find_slot (idx);
+
+	if (slot == NULL || osd_window == NULL || !gtk_widget_get_mapped (osd_window))
+		return FALSE;
+
+	gtk_widget_queue_draw (slot->icon);
+	return TRUE;
 }
 
+static void hide_osd (GtkWidget *window);
 
 gboolean
 on_event_cb (GtkWidget *widget,
@@ -259,25 +732,47 @@ on_event_cb (GtkWidget *widget,
 	switch (event->type) {
 	case GDK_BUTTON_PRESS:
 		/* g_print ("button pressed\n"); */
-		gtk_main_quit ();
+		hide_osd (gtk_widget_get_toplevel (widget));
 		break;
 	case GDK_ENTER_NOTIFY:
-		gtk_image_set_from_pixbuf (GTK_IMAGE (close_icon), close_red_pb);
+		gtk_widget_set_state_flags (close_icon, GTK_STATE_FLAG_PRELIGHT, FALSE);
+		gtk_widget_queue_draw (close_icon);
 		break;
 	case GDK_LEAVE_NOTIFY:
-		gtk_image_set_from_pixbuf (GTK_IMAGE (close_icon), close_icon_pb);
+		gtk_widget_unset_state_flags (close_icon, GTK_STATE_FLAG_PRELIGHT);
+		gtk_widget_queue_draw (close_icon);
 		break;
 	}
 
 	return FALSE;
 }
 
+/* the close mask, in the error colour while the pointer is over it */
+static gboolean
+close_draw_cb (GtkWidget *widget,
+	       cairo_t   *cr,
+	       gpointer   data)
+{
+	IconColors colors;
+
+	icon_colors (widget, &colors);
+	paint_mask (cr, ICON_CLOSE,
+		    gtk_widget_get_state_flags (widget) & GTK_STATE_FLAG_PRELIGHT ?
+		    &colors.off : &colors.fg, 0, 0);
+
+	return TRUE;
+}
+
 void init_close_button(GtkWidget **eventbox){
 	GtkWidget *close_icon;
 
 	*eventbox = gtk_event_box_new ();
 	gtk_event_box_set_visible_window (GTK_EVENT_BOX (*eventbox), FALSE);
-	close_icon = gtk_image_new_from_pixbuf (close_icon_pb);
+	close_icon = gtk_drawing_area_new ();
+	gtk_widget_set_size_request (close_icon, icon_sources[ICON_CLOSE].size,
+				     icon_sources[ICON_CLOSE].size);
+	g_signal_connect (G_OBJECT (close_icon), "draw",
+			  G_CALLBACK (close_draw_cb), NULL);
 
 	gtk_container_add (GTK_CONTAINER (*eventbox), close_icon);
 	gtk_widget_add_events (*eventbox, GDK_BUTTON_PRESS_MASK);
@@ -292,216 +787,1306 @@ void init_close_button(GtkWidget **eventbox){
 			  G_CALLBACK (on_event_cb), close_icon);
 }
 
-void init_button(GtkWidget *icon, GtkWidget *rf_switch, void *callback){
-	g_signal_connect (G_OBJECT (rf_switch), "notify::active",
-			  G_CALLBACK (callback), icon);
-	gtk_switch_set_active (GTK_SWITCH (rf_switch), TRUE);
+static void
+classify_device (RfkillDevice *dev)
+{
+	guint class;
+
+	dev->classes = 0;
+	for (class = 0; class < GRFKILL_N_CLASSES; class++)
+		if (rfkill_matcher_match (&matchers[class], dev))
+			dev->classes |= 1 << class;
 }
 
-gboolean get_rfkill_state(gchar *soft_state){
-	if (g_str_has_prefix(soft_state, "0")) {
-		return TRUE;
-	}
-	else {
-		return FALSE;
+/* also after the selectors change, without a rescan */
+static void
+classify_devices (void)
+{
+	RfkillDevice *dev;
+
+	/* the lowest matching index is what the wlan and bluetooth hotkeys toggle */
+	wlan_index = -1;
+	bt_index = -1;
+	for (dev = devices; dev < devices + n_devices; dev++) {
+		classify_device (dev);
+
+		if (wlan_index < 0 && (dev->classes & (1 << GRFKILL_CLASS_WLAN)))
+			wlan_index = dev->idx;
+		if (bt_index < 0 && (dev->classes & (1 << GRFKILL_CLASS_BT)))
+			bt_index = dev->idx;
 	}
 }
 
 void parse_directory(){
-	const gchar path[] = "/sys/class/rfkill";
-	GDir *d = g_dir_open( path,0,NULL );
-	gchar *type;
-	gchar *soft_state;
-	gchar *index;
-	gsize length;
-
-	const gchar * files;
-	while ( ( files = g_dir_read_name( d ) ) != NULL ) {
-		gchar *filename = g_build_filename( path,files,NULL );
-		/* rfkill folder is full of symlinks */
-		if ( g_file_test( filename,G_FILE_TEST_IS_SYMLINK ) ) {
-			g_file_get_contents(g_strconcat(filename, "/type",NULL), &type, &length, NULL);
-			g_file_get_contents(g_strconcat(filename, "/index",NULL), &index, &length, NULL);
-			g_file_get_contents(g_strconcat(filename, "/soft",NULL), &soft_state, &length, NULL);
-
-			if (g_strrstr (type, wlan_device)) {
-				wlan_state = get_rfkill_state(soft_state);
-				wlan_index = g_ascii_strtoll(index, NULL, 10);
-			}
-			else if (g_strrstr (type, bt_device)) {
-				bt_state = get_rfkill_state(soft_state);
-				bt_index = g_ascii_strtoll(index, NULL, 10);
-			}
-			g_free(index);
-			g_free(type);
-			g_free(soft_state);
-			g_free( filename );
-		}
+	RfkillDevice *dev;
+	gint64 start = GRFKILL_PROBE_ENABLED (scan_done) ? g_get_monotonic_time () : 0;
+	gint n;
+
+	GRFKILL_PROBE0 (scan_start);
+
+	n = rfkill_sysfs_scan (devices, G_N_ELEMENTS (devices));
+	if (n < 0)
+		return;
+	n_devices = n;
+
+	for (dev = devices; dev < devices + n_devices; dev++) {
+		metrics_device (dev);
+		duty_record (dev);
 	}
-	g_dir_close( d );
-}
+	classify_devices ();
 
-void init_pixbufs(){
-	bt_blocked_pb     = gdk_pixbuf_from_pixdata(&bt_blocked_inline, TRUE, NULL);
-	bt_unblocked_pb   = gdk_pixbuf_from_pixdata(&bt_unblocked_inline, TRUE, NULL);
-	close_icon_pb     = gdk_pixbuf_from_pixdata(&close_inline, TRUE, NULL);
-	close_red_pb      = gdk_pixbuf_from_pixdata(&close_red_inline, TRUE, NULL);
-	wlan_blocked_pb   = gdk_pixbuf_from_pixdata(&wlan_blocked_inline, TRUE, NULL);
-	wlan_unblocked_pb = gdk_pixbuf_from_pixdata(&wlan_unblocked_inline, TRUE, NULL);
-	wwan_blocked_pb   = gdk_pixbuf_from_pixdata(&wwan_blocked_inline, TRUE, NULL);
-	wwan_unblocked_pb = gdk_pixbuf_from_pixdata(&wwan_unblocked_inline, TRUE, NULL);
+	if (GRFKILL_PROBE_ENABLED (scan_done) && start)
+		GRFKILL_PROBE2 (scan_done, n_devices, g_get_monotonic_time () - start);
 }
 
-static gboolean
-quit_timeout_handler(GtkWidget *window)
+/* wlan first, then bluetooth, then the rest in kernel type order */
+static guint
+type_rank (guint8 type)
 {
-	if (window == NULL) return FALSE;
-
-	gtk_widget_destroy (window);
-	exit(0);
+	if (type == RFKILL_TYPE_WLAN)
+		return 0;
+	if (type == RFKILL_TYPE_BLUETOOTH)
+		return 1;
+	return 2 + type;
+}
 
-	return TRUE;
+static gint
+compare_shown (gconstpointer a, gconstpointer b)
+{
+	const RfkillDevice *da = find_device (*(const guint32 *) a);
+	const RfkillDevice *db = find_device (*(const guint32 *) b);
+	guint ra = type_rank (da->type);
+	guint rb = type_rank (db->type);
+
+	if (ra != rb)
+		return ra < rb ? -1 : 1;
+	return da->idx < db->idx ? -1 : da->idx > db->idx;
 }
 
+/*
+ * Orders the selected devices by type and cuts them into pages of
+ * OSD_SLOTS. A type group that would straddle a page break starts a new
+ * page instead, as long as it fits on one.
+ */
 static void
-parse_option(gint *pargc, gchar **pargv[]){
-	GOptionContext *context;
-	GError *err = NULL;
+layout_pages (void)
+{
+	RfkillDevice *dev;
+	guint fill = 0;
+	guint group;
+	guint i;
+	guint j;
+
+	n_shown = 0;
+	for (dev = devices; dev < devices + n_devices; dev++)
+		if (dev->classes)
+			shown[n_shown++] = dev->idx;
+	qsort (shown, n_shown, sizeof (shown[0]), compare_shown);
+
+	n_pages = 0;
+	page_start[0] = 0;
+	for (i = 0; i < n_shown; i = j) {
+		for (j = i; j < n_shown &&
+		     find_device (shown[j])->type == find_device (shown[i])->type; j++)
+			;
+		group = j - i;
+		if (fill > 0 && fill + group > OSD_SLOTS && group <= OSD_SLOTS) {
+			page_start[++n_pages] = i;
+			fill = 0;
+		}
+		while (fill + group > OSD_SLOTS) {
+			group -= OSD_SLOTS - fill;
+			page_start[++n_pages] = j - group;
+			fill = 0;
+		}
+		fill += group;
+	}
+	if (n_shown > 0)
+		n_pages++;
+	page_start[n_pages] = n_shown;
 
-	GOptionEntry entries[] = {
-		{ "wlan", 'w', 0, G_OPTION_ARG_STRING, &wlan_device,
-			"set the rfkill name for your wireless device", "acer-wireless" },
-		{ "bluetooth", 'b', 0, G_OPTION_ARG_STRING, &bt_device,
-			"set the rfkill name for your bluetooth device", "acer-bluetooth" },
-		{ NULL }
-	};
+	if (page >= n_pages)
+		page = n_pages ? n_pages - 1 : 0;
+}
 
-	context = g_option_context_new ("");
-	g_option_context_add_main_entries (context, entries, NULL);
-	g_option_context_add_group(context, gtk_get_option_group(TRUE));
-	if (!g_option_context_parse(context, pargc, pargv, &err)) {
-		g_print ("Failed to initialize: %s\n", err->message);
-		exit(0);
-	}
+/* the page that has idx on it, or the current one */
+static guint
+page_of (guint32 idx)
+{
+	guint p;
+	guint i;
 
-	if (wlan_device == NULL) {
-		wlan_device = DEFAULT_WLAN;
-	}
-	if (bt_device == NULL) {
-		bt_device = DEFAULT_BT;
-	}
+	for (p = 0; p < n_pages; p++)
+		for (i = page_start[p]; i < page_start[p + 1]; i++)
+			if (shown[i] == idx)
+				return p;
+
+	return page;
 }
 
-int
-main (int argc, char *argv[])
+/* move the switches to the kernel state without writing it back */
+static void
+sync_switches (void)
 {
-	GtkSettings *settings;
+	OsdSlot *slot;
+	RfkillDevice *dev;
+	gchar text[16];
+	guint i;
+
+	layout_pages ();
+	if (osd_window == NULL)
+		return;
+
+	syncing = TRUE;
+	for (i = 0; i < OSD_SLOTS; i++) {
+		slot = &slots[i];
+		dev = NULL;
+		if (n_pages > 0 && page_start[page] + i < page_start[page + 1])
+			dev = find_device (shown[page_start[page] + i]);
+
+		slot->bound = dev != NULL;
+		gtk_widget_set_visible (slot->icon, slot->bound);
+		gtk_widget_set_visible (slot->sw, slot->bound);
+		if (dev == NULL)
+			continue;
+
+		slot->idx = dev->idx;
+		gtk_switch_set_active (GTK_SWITCH (slot->sw), !dev->soft);
+		slot_set_icon (slot, dev, !dev->soft);
+	}
+	syncing = FALSE;
 
-	GtkCssProvider *css_provider;
-	GtkStyleContext *style_context;
+	g_snprintf (text, sizeof (text), "%u/%u", page + 1, n_pages);
+	if (g_strcmp0 (gtk_label_get_text (GTK_LABEL (page_label)), text) != 0)
+		gtk_label_set_text (GTK_LABEL (page_label), text);
+	gtk_widget_set_visible (page_label, n_pages > 1);
+}
 
-	GtkWidget *window;
-	GtkWidget *eventbox;
-	GtkWidget *wifi_icon;
-	GtkWidget *bt_icon;
-	GtkWidget *wwan_icon;
-	GtkWidget *rf_switch1;
-	GtkWidget *rf_switch2;
-	GtkWidget *rf_switch3;
-	GtkWidget *grid;
+/*
+ * Centre on the primary monitor ourselves, once per show or page flip.
+ * GTK_WIN_POS_CENTER_ALWAYS re-placed the popup on every configure and
+ * read _NET_WORKAREA from the server each time.
+ */
+static void
+place_osd (void)
+{
+	GdkDisplay *display = gtk_widget_get_display (osd_window);
+	GdkMonitor *monitor = gdk_display_get_primary_monitor (display);
+	GdkRectangle area;
+	GtkRequisition size;
+
+	if (monitor == NULL)
+		monitor = gdk_display_get_monitor (display, 0);
+	if (monitor == NULL)
+		return;
+
+	gdk_monitor_get_geometry (monitor, &area);
+	gtk_widget_get_preferred_size (osd_window, NULL, &size);
+	gtk_window_move (GTK_WINDOW (osd_window),
+			 area.x + (area.width - size.width) / 2,
+			 area.y + (area.height - size.height) / 2);
+}
 
-	GtkBorder padding;
+static void
+flip_page (gint delta)
+{
+	if (n_pages < 2)
+		return;
 
-	gtk_init (&argc, &argv);
+	page = (page + n_pages + delta) % n_pages;
+	sync_switches ();
+	place_osd ();
+}
 
-	/* parse commandline options */
-	parse_option(&argc, &argv);
+static gboolean
+page_scroll_cb (GtkWidget      *widget,
+		GdkEventScroll *event,
+		gpointer        data)
+{
+	if (event->direction == GDK_SCROLL_UP || event->direction == GDK_SCROLL_LEFT)
+		flip_page (-1);
+	else if (event->direction == GDK_SCROLL_DOWN || event->direction == GDK_SCROLL_RIGHT)
+		flip_page (1);
 
-	/* initialize states */
-	parse_directory();
-	init_pixbufs();
+	return TRUE;
+}
 
-	settings = gtk_settings_get_default ();
-	g_object_set (G_OBJECT (settings),
-		      "gtk-application-prefer-dark-theme", TRUE,
-		      NULL);
+static gboolean
+page_click_cb (GtkWidget      *widget,
+	       GdkEventButton *event,
+	       gpointer        data)
+{
+	flip_page (event->button == 3 ? -1 : 1);
+	return TRUE;
+}
 
-	css_provider = gtk_css_provider_new ();
-	if (!gtk_css_provider_load_from_data (css_provider, css_data, sizeof(css_data), NULL)) {
-		g_warning ("Failed to load css");
-		return -1;
+static void
+rfkill_event_cb (const struct rfkill_event *event,
+		 gpointer                   user_data)
+{
+	RfkillDevice *dev = find_device (event->idx);
+	gboolean old_soft;
+	gboolean old_hard;
+
+	GRFKILL_PROBE5 (event, event->idx, event->type, event->op,
+			event->soft, event->hard);
+	metrics_event (event->op);
+
+	switch (event->op) {
+	case RFKILL_OP_ADD:
+	case RFKILL_OP_CHANGE:
+		if (dev == NULL) {
+			/* new device: sysfs has the name the selectors need */
+			parse_directory();
+			rfkill_dbus_devices_changed ();
+			break;
+		}
+		if (dev->soft == event->soft && dev->hard == event->hard)
+			return;
+		old_soft = dev->soft;
+		old_hard = dev->hard;
+		dev->soft = event->soft;
+		dev->hard = event->hard;
+		audit_change (dev, old_soft, old_hard);
+		latency_event (dev->idx, queue_slot_frame (dev->idx));
+		metrics_device (dev);
+		duty_record (dev);
+		rfkill_dbus_device_changed (dev);
+		break;
+	case RFKILL_OP_DEL:
+		if (dev == NULL)
+			return;
+		duty_record_gone (dev->idx);
+		metrics_device_gone (dev->idx);
+		parse_directory();
+		rfkill_dbus_devices_changed ();
+		break;
+	default:
+		return;
 	}
 
-	window = gtk_window_new (GTK_WINDOW_POPUP);
-	gtk_widget_set_app_paintable(window, TRUE);
-
-	style_context = gtk_widget_get_style_context (window);
-	gtk_style_context_add_provider (style_context,
-					GTK_STYLE_PROVIDER (css_provider),
-					GTK_STYLE_PROVIDER_PRIORITY_APPLICATION);
+	sync_switches ();
+	rfkill_shm_publish (devices, n_devices);
+	policy_radio_changed ();
+}
 
-	set_visual (window);
+/*
+ * Go through the switch when the device has one, so its icon follows.
+ * Returns what the write returned; unblocking a hard-blocked radio is
+ * written but fails with -ERFKILL, as the radio stays off.
+ */
+static gint
+set_blocked_as (guint8 who, guint32 idx, gboolean blocked)
+{
+	RfkillDevice *dev = find_device (idx);
+	OsdSlot *slot;
+	gint err;
 
-	g_signal_connect (G_OBJECT (window), "draw", G_CALLBACK (draw_widget), NULL);
-	g_signal_connect (G_OBJECT (window), "screen_changed", G_CALLBACK (screen_change_cb), NULL);
+	if (dev == NULL)
+		return -ENODEV;
 
-	grid = gtk_grid_new ();
+	initiator = who;
+	write_error = 0;
+	if ((slot = find_slot (idx)))
+		gtk_switch_set_active (GTK_SWITCH (slot->sw), !blocked);
+	else
+		rfkill_set_block (idx, blocked);
+	err = write_error;
+	initiator = AUDIT_OSD;
 
-	wifi_icon = gtk_image_new ();
-	rf_switch1 = gtk_switch_new ();
-	init_button(wifi_icon, rf_switch1, wlan_switch_activate_cb);
-	gtk_switch_set_active (GTK_SWITCH (rf_switch1), wlan_state);
+	if (err == 0 && !blocked && dev->hard)
+		err = -ERFKILL;
 
-	bt_icon = gtk_image_new ();
-	rf_switch2 = gtk_switch_new ();
-	init_button(bt_icon, rf_switch2, bt_switch_activate_cb);
-	gtk_switch_set_active (GTK_SWITCH (rf_switch2), bt_state);
+	return err;
+}
 
-	wwan_icon = gtk_image_new ();
-	rf_switch3 = gtk_switch_new ();
-	init_button(wwan_icon, rf_switch3, wwan_switch_activate_cb);
+static gint
+set_device_blocked (guint32 idx, gboolean blocked)
+{
+	return set_blocked_as (AUDIT_DBUS, idx, blocked);
+}
 
-	// rfkill will now be used
-	initialized = TRUE;
+/*
+ * One pass of the policy engine, one write per device. Not a single
+ * RFKILL_OP_CHANGE_ALL for a type: that also sets the kernel's default
+ * for radios of the type plugged in later, which no rule asked for. The
+ * switches catch up from the events, as for any other rfkill user.
+ */
+static void
+policy_apply_cb (const PolicyWrite *writes, guint n_writes)
+{
+	guint i;
 
-	init_close_button(&eventbox);
+	initiator = AUDIT_POLICY;
+	for (i = 0; i < n_writes; i++)
+		rfkill_set_block (writes[i].idx, writes[i].blocked);
+	initiator = AUDIT_OSD;
+}
 
-	gtk_grid_set_row_spacing ((GtkGrid *)grid, 10);
-	gtk_grid_set_column_spacing ((GtkGrid *)grid, 5);
-	gtk_grid_attach ((GtkGrid *)grid, eventbox, ICON_SAPCE*3-1, 0, 1, 1);
-	gtk_grid_attach ((GtkGrid *)grid, wifi_icon, 0, 1, ICON_SAPCE, 1);
-	gtk_grid_attach_next_to ((GtkGrid *)grid, rf_switch1, wifi_icon, GTK_POS_BOTTOM, ICON_SAPCE, 1);
+/* one mask, from the config's override if it has a usable one */
+static void
+load_icon (guint i, gint scale)
+{
+	const gchar *path = config ? config->icons[i] : NULL;
+
+	g_clear_pointer (&icons[i], cairo_surface_destroy);
+	if (path) {
+		icons[i] = icon_cache_load (icon_sources[i].name, path, icon_sources[i].size,
+					    icon_sources[i].size, scale);
+		if (icons[i] == NULL)
+			g_warning ("Cannot render %s, using the built-in icon", path);
+	}
+	if (icons[i] == NULL)
+		icons[i] = icon_cache_load (icon_sources[i].name, NULL, icon_sources[i].size,
+					    icon_sources[i].size, scale);
+	/* the OSD still works, the badges and switches tell the state */
+	if (icons[i] == NULL)
+		g_warning ("Cannot render %s.svg, is the SVG pixbuf loader installed?",
+			   icon_sources[i].name);
+}
 
+/* the icon masks for a scale factor, from the raster cache */
+static void
+init_icons (gint scale)
+{
+	guint i;
 
-	/* show bt icon */
-	gtk_grid_attach_next_to ((GtkGrid *)grid, bt_icon, wifi_icon, GTK_POS_RIGHT, ICON_SAPCE, 1);
-	gtk_grid_attach_next_to ((GtkGrid *)grid, rf_switch2, bt_icon, GTK_POS_BOTTOM, ICON_SAPCE, 1);
+	for (i = 0; i < N_ICONS; i++)
+		load_icon (i, scale);
+	icon_scale = scale;
+}
 
-	/* show wwan icon */
-	if (wwan_index != 0){
-		gtk_grid_attach_next_to ((GtkGrid *)grid, wwan_icon, bt_icon, GTK_POS_RIGHT, ICON_SAPCE, 1);
-		gtk_grid_attach_next_to ((GtkGrid *)grid, rf_switch3, wwan_icon, GTK_POS_BOTTOM, ICON_SAPCE, 1);
-	}
+/* before the display is open only GDK_SCALE tells; build_osd corrects it */
+static gint
+guess_scale (void)
+{
+	const gchar *env = g_getenv ("GDK_SCALE");
+	gint scale = env ? atoi (env) : 1;
 
-	gtk_container_add (GTK_CONTAINER (window), grid);
+	return MAX (scale, 1);
+}
 
-//	gtk_window_set_decorated (GTK_WINDOW (window), FALSE);
-//	gtk_window_set_keep_above (GTK_WINDOW (window), TRUE);
-//	gtk_window_set_has_resize_grip (GTK_WINDOW (window), FALSE);
-	gtk_style_context_get_padding (style_context, GTK_STATE_NORMAL, &padding);
-	gtk_container_set_border_width (GTK_CONTAINER (window), 12 + MAX (padding.left, padding.top));
-	gtk_window_set_position (GTK_WINDOW (window), GTK_WIN_POS_CENTER_ALWAYS);
+static void
+clear_icons (void)
+{
+	guint i;
 
-	gtk_widget_grab_focus (window);
+	for (i = 0; i < N_ICONS; i++)
+		g_clear_pointer (&icons[i], cairo_surface_destroy);
+}
 
-	g_timeout_add(4000, (GSourceFunc) quit_timeout_handler, (gpointer) window);
-	gtk_widget_show_all (window);
+/* runs on the probe thread: neither step needs the display connection */
+static gpointer
+probe_thread_func (gpointer data)
+{
+	gint64 start = g_get_monotonic_time ();
 
-	gtk_main ();
+	parse_directory();
+	init_icons (guess_scale ());
 
-	gtk_widget_destroy (window);
+	probe_usec = g_get_monotonic_time () - start;
+	return NULL;
+}
+
+/* moved to a monitor with another scale: rasterize the icons for it */
+static void
+scale_factor_cb (GtkWidget  *window,
+		 GParamSpec *pspec,
+		 gpointer    data)
+{
+	gint scale = gtk_widget_get_scale_factor (window);
+
+	if (scale == icon_scale)
+		return;
+
+	init_icons (scale);
+	gtk_widget_queue_draw (window);
+}
+
+/* write out everything that is batched before the process goes away */
+static void
+finish (void)
+{
+	if (latency)
+		latency_report ();
+	metrics_sync ();
+	audit_close ();
+	duty_close ();
+	rfkill_shm_close ();
+}
+
+/* the OSD's window rules, on top of whatever theme is in use */
+static gboolean
+load_css (void)
+{
+	css_provider = gtk_css_provider_new ();
+	return gtk_css_provider_load_from_data (css_provider, css_data, sizeof(css_data), NULL);
+}
+
+/* the widget tree; also rebuilds it on show after an idle trim */
+static void
+build_osd (void)
+{
+	GtkStyleContext *style_context;
+
+	GtkWidget *window;
+	GtkWidget *eventbox;
+	GtkWidget *pager;
+	GtkWidget *grid;
+	OsdSlot *slot;
+
+	GtkBorder padding;
+	guint i;
+
+	initialized = FALSE;
+
+	window = offscreen ? gtk_offscreen_window_new () : gtk_window_new (GTK_WINDOW_POPUP);
+	gtk_widget_set_app_paintable(window, TRUE);
+
+	style_context = gtk_widget_get_style_context (window);
+	gtk_style_context_add_provider (style_context,
+					GTK_STYLE_PROVIDER (css_provider),
+					GTK_STYLE_PROVIDER_PRIORITY_APPLICATION);
+
+	/* offscreen there is nothing to composite: keep the translucent frame */
+	if (!offscreen)
+		set_visual (window);
+
+	/* probed before the display was open; rasterize for the real scale */
+	if (gtk_widget_get_scale_factor (window) != icon_scale)
+		init_icons (gtk_widget_get_scale_factor (window));
+
+	g_signal_connect (G_OBJECT (window), "draw", G_CALLBACK (draw_widget), NULL);
+	g_signal_connect (G_OBJECT (window), "screen_changed", G_CALLBACK (screen_change_cb), NULL);
+	g_signal_connect (G_OBJECT (window), "size-allocate", G_CALLBACK (size_allocate_cb), NULL);
+	g_signal_connect (G_OBJECT (window), "notify::scale-factor", G_CALLBACK (scale_factor_cb), NULL);
+	gtk_widget_add_events (window, GDK_SCROLL_MASK);
+	g_signal_connect (G_OBJECT (window), "scroll-event", G_CALLBACK (page_scroll_cb), NULL);
+
+	grid = gtk_grid_new ();
+	gtk_grid_set_row_spacing ((GtkGrid *)grid, OSD_ROW_SPACING);
+	gtk_grid_set_column_spacing ((GtkGrid *)grid, OSD_COL_SPACING);
+
+	init_close_button(&eventbox);
+	gtk_grid_attach ((GtkGrid *)grid, eventbox, ICON_SAPCE*OSD_SLOTS-1, 0, 1, 1);
+
+	/* "2/3", only shown with more than one page; click or scroll to flip */
+	pager = gtk_event_box_new ();
+	gtk_event_box_set_visible_window (GTK_EVENT_BOX (pager), FALSE);
+	page_label = gtk_label_new (NULL);
+	gtk_widget_set_no_show_all (page_label, TRUE);
+	gtk_container_add (GTK_CONTAINER (pager), page_label);
+	gtk_widget_add_events (pager, GDK_BUTTON_PRESS_MASK);
+	g_signal_connect (G_OBJECT (pager), "button-press-event",
+			  G_CALLBACK (page_click_cb), NULL);
+	gtk_grid_attach ((GtkGrid *)grid, pager, 0, 0, ICON_SAPCE, 1);
+
+	for (i = 0; i < OSD_SLOTS; i++) {
+		slot = &slots[i];
+		slot->icon = gtk_drawing_area_new ();
+		gtk_widget_set_size_request (slot->icon, icon_sources[ICON_WLAN].size,
+					     icon_sources[ICON_WLAN].size);
+		g_signal_connect (G_OBJECT (slot->icon), "draw",
+				  G_CALLBACK (slot_draw_cb), slot);
+		slot->sw = gtk_switch_new ();
+		slot->bound = FALSE;
+		/* sync_switches decides which slots are visible */
+		gtk_widget_set_no_show_all (slot->icon, TRUE);
+		gtk_widget_set_no_show_all (slot->sw, TRUE);
+		g_signal_connect (G_OBJECT (slot->sw), "notify::active",
+				  G_CALLBACK (slot_switch_cb), slot);
+		gtk_grid_attach ((GtkGrid *)grid, slot->icon, i * ICON_SAPCE, 1, ICON_SAPCE, 1);
+		gtk_grid_attach_next_to ((GtkGrid *)grid, slot->sw, slot->icon, GTK_POS_BOTTOM, ICON_SAPCE, 1);
+	}
+
+	osd_window = window;
+	sync_switches ();
+
+	// rfkill will now be used
+	initialized = TRUE;
+
+	gtk_container_add (GTK_CONTAINER (window), grid);
+
+//	gtk_window_set_decorated (GTK_WINDOW (window), FALSE);
+//	gtk_window_set_keep_above (GTK_WINDOW (window), TRUE);
+//	gtk_window_set_has_resize_grip (GTK_WINDOW (window), FALSE);
+	gtk_style_context_get_padding (style_context, GTK_STATE_NORMAL, &padding);
+	gtk_container_set_border_width (GTK_CONTAINER (window), OSD_BORDER + MAX (padding.left, padding.top));
+}
+
+/* give back what a hidden resident OSD holds; show_osd rebuilds it */
+static gboolean
+trim_timeout_cb (gpointer data)
+{
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_TIMEOUT);
+	trim_timeout_id = 0;
+
+	if (osd_window == NULL || gtk_widget_get_visible (osd_window))
+		return G_SOURCE_REMOVE;
+
+	initialized = FALSE;
+	memset (slots, 0, sizeof (slots));
+	page_label = NULL;
+	g_clear_pointer (&shape_region, cairo_region_destroy);
+	gtk_widget_destroy (osd_window);
+	osd_window = NULL;
+	fade_opacity = 1.0;
+
+	clear_icons ();
+
+#ifdef __GLIBC__
+	malloc_trim (0);
+#endif
+
+	return G_SOURCE_REMOVE;
+}
+
+/* one shot, so a hidden OSD costs at most a single wakeup */
+static void
+arm_trim (void)
+{
+	if (!resident || idle_trim <= 0 || osd_window == NULL || trim_timeout_id)
+		return;
+
+	trim_timeout_id = g_timeout_add_seconds (idle_trim, trim_timeout_cb, NULL);
+}
+
+/* counts every return from a blocking poll, i.e. every time we were woken */
+static gint
+counting_poll (GPollFD *fds, guint nfds, gint timeout)
+{
+	gint ret = default_poll (fds, nfds, timeout);
+
+	if (timeout != 0)
+		rfkill_shm_wakeup (GRFKILL_WAKEUP_POLL);
+
+	return ret;
+}
+
+/* nothing may tick while hidden; the hide timeout is the only timer */
+static void
+set_animations (gboolean enabled)
+{
+	g_object_set (G_OBJECT (gtk_settings_get_default ()),
+		      "gtk-enable-animations", enabled,
+		      NULL);
+}
+
+/* only a compositor can blend; without one the OSD pops as before */
+static gboolean
+can_fade (GtkWidget *window)
+{
+	GdkWindow *gdk_window = gtk_widget_get_window (window);
+
+	return !opaque && gdk_window != NULL && GDK_IS_X11_WINDOW (gdk_window);
+}
+
+/* sets _NET_WM_WINDOW_OPACITY; unlike gtk_widget_set_opacity it queues no redraw */
+static void
+set_fade_opacity (GtkWidget *window, gdouble opacity)
+{
+	fade_opacity = opacity;
+	gdk_window_set_opacity (gtk_widget_get_window (window), opacity);
+}
+
+/* the OSD is off the screen: keep it for the next show, or quit */
+static void
+osd_hidden (GtkWidget *window)
+{
+	if (!resident) {
+		gtk_main_quit ();
+		return;
+	}
+
+	gtk_widget_hide (window);
+	set_animations (FALSE);
+	audit_flush ();
+	arm_trim ();
+}
+
+static gboolean
+fade_tick_cb (GtkWidget     *window,
+	      GdkFrameClock *frame_clock,
+	      gpointer       data)
+{
+	gint64 now = gdk_frame_clock_get_frame_time (frame_clock);
+	gdouble t;
+
+	if (fade_start < 0)
+		fade_start = now;
+	t = fade_usec > 0 ? MIN ((now - fade_start) / (gdouble) fade_usec, 1.0) : 1.0;
+
+	fade_frames++;
+	set_fade_opacity (window, fade_from + (fade_to - fade_from) * t);
+	if (t < 1.0)
+		return G_SOURCE_CONTINUE;
+
+	fade_tick_id = 0;
+	metrics_fade (fade_frames, repaints - fade_repaints_start);
+	if (fade_to == 0.0)
+		osd_hidden (window);
+
+	return G_SOURCE_REMOVE;
+}
+
+/* from the current opacity, so reversing half way takes half the time */
+static void
+start_fade (GtkWidget *window, gdouble to, gint64 usec)
+{
+	if (fade_tick_id)
+		gtk_widget_remove_tick_callback (window, fade_tick_id);
+
+	fade_from = fade_opacity;
+	fade_to = to;
+	fade_usec = usec * ABS (to - fade_from);
+	fade_start = -1;
+	fade_frames = 0;
+	fade_repaints_start = repaints;
+	fade_tick_id = gtk_widget_add_tick_callback (window, fade_tick_cb, NULL, NULL);
+}
+
+static void
+hide_osd (GtkWidget *window)
+{
+	if (hide_timeout_id) {
+		g_source_remove (hide_timeout_id);
+		hide_timeout_id = 0;
+	}
+
+	if (can_fade (window))
+		start_fade (window, 0.0, FADE_OUT_USEC);
+	else
+		osd_hidden (window);
+}
+
+static gboolean
+quit_timeout_handler(GtkWidget *window)
+{
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_TIMEOUT);
+
+	hide_timeout_id = 0;
+	if (window == NULL) return FALSE;
+
+	hide_osd (window);
+
+	return FALSE;
+}
+
+static void
+compile_selectors (guint class)
+{
+	static const gchar *const fallbacks[GRFKILL_N_CLASSES] = {
+		[GRFKILL_CLASS_WLAN] = DEFAULT_WLAN,
+		[GRFKILL_CLASS_BT]   = DEFAULT_BT,
+	};
+	gchar *defaults[] = { (gchar *) fallbacks[class], NULL };
+	gchar **selectors;
+	GError *err = NULL;
+
+	/* the command line, else the config file, else the default */
+	selectors = class == GRFKILL_CLASS_WLAN ? wlan_selectors : bt_selectors;
+	if (selectors == NULL)
+		selectors = config->selectors[class];
+
+	if (!rfkill_matcher_compile (&matchers[class],
+				     selectors ? selectors : defaults, &err)) {
+		g_print ("Failed to initialize: %s\n", err->message);
+		exit(0);
+	}
+}
+
+static void
+show_osd (void)
+{
+	/* without the event watch the table may be stale */
+	if (!rfkill_event_watching ()) {
+		parse_directory();
+		sync_switches ();
+	}
+
+	if (trim_timeout_id) {
+		g_source_remove (trim_timeout_id);
+		trim_timeout_id = 0;
+	}
+	if (osd_window == NULL) {
+		init_icons (icon_scale);
+		build_osd ();
+	}
+
+	if (hide_timeout_id)
+		g_source_remove (hide_timeout_id);
+	hide_timeout_id = g_timeout_add(4000, (GSourceFunc) quit_timeout_handler, (gpointer) osd_window);
+	if (resident)
+		set_animations (TRUE);
+	place_osd ();
+
+	/* mapped transparent; only the first frame draws, the rest is opacity */
+	gtk_widget_realize (osd_window);
+	if (can_fade (osd_window)) {
+		if (!gtk_widget_get_visible (osd_window))
+			set_fade_opacity (osd_window, 0.0);
+		if (fade_opacity < 1.0 || fade_tick_id)
+			start_fade (osd_window, 1.0, FADE_IN_USEC);
+	} else if (fade_opacity != 1.0) {
+		if (fade_tick_id)
+			gtk_widget_remove_tick_callback (osd_window, fade_tick_id);
+		fade_tick_id = 0;
+		set_fade_opacity (osd_window, 1.0);
+	}
+	gtk_widget_show_all (osd_window);
+	profile_mark ("mapped");
+}
+
+/* a grabbed key: show the OSD and flip the radio right here, no spawn */
+static void
+hotkey_cb (guint action)
+{
+	RfkillDevice *dev;
+	gint64 idx;
+	gboolean block = FALSE;
+
+	show_osd ();
+
+	switch (action) {
+	case HOTKEY_WLAN:
+	case HOTKEY_BLUETOOTH:
+		idx = action == HOTKEY_WLAN ? wlan_index : bt_index;
+		if (idx < 0 || (dev = find_device (idx)) == NULL)
+			break;
+		/* bring its page up so the toggle is visible */
+		if (page_of (dev->idx) != page) {
+			page = page_of (dev->idx);
+			sync_switches ();
+		}
+		set_blocked_as (AUDIT_HOTKEY, dev->idx, !dev->soft);
+		break;
+	case HOTKEY_ALL:
+		/* like most laptops: block everything unless all is blocked */
+		for (dev = devices; dev < devices + n_devices; dev++)
+			if (!dev->soft)
+				block = TRUE;
+		for (dev = devices; dev < devices + n_devices; dev++)
+			if (dev->soft != block)
+				set_blocked_as (AUDIT_HOTKEY, dev->idx, block);
+		break;
+	}
+}
+
+/* the config file or an icon it names was edited; redo only what changed */
+static void
+config_changed_cb (const GrfkillConfig *cfg,
+		   guint                changed,
+		   guint                icons_changed)
+{
+	gboolean reclassify = FALSE;
+	guint class;
+	guint i;
+
+	for (class = 0; class < GRFKILL_N_CLASSES; class++) {
+		/* the command line still wins */
+		if (!(changed & CONFIG_CHANGED_SELECTORS (class)) ||
+		    (class == GRFKILL_CLASS_WLAN ? wlan_selectors : bt_selectors))
+			continue;
+		compile_selectors (class);
+		reclassify = TRUE;
+	}
+
+	if (reclassify) {
+		classify_devices ();
+		sync_switches ();
+	}
+
+	if (changed & CONFIG_CHANGED_RULES)
+		policy_load (cfg);
+
+	/* a trimmed OSD loads them when it is shown again */
+	if (osd_window == NULL)
+		return;
+
+	for (i = 0; i < N_ICONS; i++) {
+		if (!(icons_changed & (1 << i)))
+			continue;
+		load_icon (i, icon_scale);
+		if (i == ICON_CLOSE)
+			gtk_widget_queue_draw (osd_window);
+	}
+	for (i = 0; i < OSD_SLOTS; i++)
+		if (slots[i].bound && (icons_changed & (1 << slots[i].glyph)))
+			gtk_widget_queue_draw (slots[i].icon);
+}
+
+static gboolean
+show_signal_cb (gpointer data)
+{
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_SIGNAL);
+	show_osd ();
+	return G_SOURCE_CONTINUE;
+}
+
+static gboolean
+latency_signal_cb (gpointer data)
+{
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_SIGNAL);
+	latency_report ();
+	return G_SOURCE_CONTINUE;
+}
+
+static gboolean
+quit_signal_cb (gpointer data)
+{
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_SIGNAL);
+	gtk_main_quit ();
+	return G_SOURCE_CONTINUE;
+}
+
+/*
+ * Offscreen rendering for golden images and frame cost. build_osd puts
+ * the real widget tree in a GtkOffscreenWindow, which gtk_widget_draw
+ * paints into an image surface. That still needs a display, Xvfb will
+ * do, and always uses the built-in theme so the desktop's cannot change
+ * the picture.
+ */
+#define GOLDEN_TOLERANCE 2	/* per channel, for pixman rounding between versions */
+
+/* a device table entry for the renderer, selected by its type's class */
+static void
+render_device (guint i, guint type, gboolean soft, const gchar *name)
+{
+	RfkillDevice *dev = &devices[i];
+
+	memset (dev, 0, sizeof (RfkillDevice));
+	dev->idx = i;
+	dev->type = type;
+	dev->soft = soft;
+	dev->classes = 1 << (type == RFKILL_TYPE_BLUETOOTH ?
+			     GRFKILL_CLASS_BT : GRFKILL_CLASS_WLAN);
+	g_strlcpy (dev->name, name, GRFKILL_NAME_LEN);
+}
+
+/* "wlan=on,bt=off" into the device table, one page at most */
+static gboolean
+parse_render_state (const gchar *spec)
+{
+	gchar **items = g_strsplit (spec, ",", -1);
+	gchar **item;
+	gchar *value;
+	guint type;
+
+	n_devices = 0;
+	for (item = items; *item && **item; item++) {
+		value = strchr (*item, '=');
+		if (value)
+			*value++ = '\0';
+		type = g_ascii_strcasecmp (*item, "bt") == 0 ?
+			RFKILL_TYPE_BLUETOOTH : rfkill_type_from_name (*item);
+
+		if (type == NUM_RFKILL_TYPES || n_devices == OSD_SLOTS ||
+		    (value && g_strcmp0 (value, "on") != 0 && g_strcmp0 (value, "off") != 0)) {
+			g_printerr ("Bad --state entry \"%s\", use up to %d of type=on|off\n",
+				    *item, OSD_SLOTS);
+			g_strfreev (items);
+			return FALSE;
+		}
+
+		render_device (n_devices, type, g_strcmp0 (value, "off") == 0, *item);
+		n_devices++;
+	}
+
+	g_strfreev (items);
+	return TRUE;
+}
+
+/* lays the tree out for the device table and sizes a surface to match */
+static cairo_surface_t *
+render_surface (gint scale)
+{
+	cairo_surface_t *surface;
+	gint width, height;
+
+	sync_switches ();
+	gtk_container_check_resize (GTK_CONTAINER (osd_window));
+	width = gtk_widget_get_allocated_width (osd_window);
+	height = gtk_widget_get_allocated_height (osd_window);
+
+	surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32,
+					      width * scale, height * scale);
+	cairo_surface_set_device_scale (surface, scale, scale);
+	return surface;
+}
+
+/* one frame, through the same draw handlers as the mapped OSD */
+static void
+render_frame (cairo_surface_t *surface)
+{
+	cairo_t *cr = cairo_create (surface);
+
+	gtk_widget_draw (osd_window, cr);
+	cairo_destroy (cr);
+	cairo_surface_flush (surface);
+}
+
+/* pixels off by more than GOLDEN_TOLERANCE in a channel, -1 if unusable */
+static gint
+compare_golden (cairo_surface_t *surface, const gchar *path)
+{
+	cairo_surface_t *golden = cairo_image_surface_create_from_png (path);
+	const guchar *a, *b;
+	gint width, height;
+	gint bad = 0;
+	gint x, y, c;
+
+	if (cairo_surface_status (golden) != CAIRO_STATUS_SUCCESS) {
+		g_printerr ("Cannot read %s: %s\n", path,
+			    cairo_status_to_string (cairo_surface_status (golden)));
+		cairo_surface_destroy (golden);
+		return -1;
+	}
+
+	width = cairo_image_surface_get_width (surface);
+	height = cairo_image_surface_get_height (surface);
+	if (cairo_image_surface_get_format (golden) != CAIRO_FORMAT_ARGB32 ||
+	    cairo_image_surface_get_width (golden) != width ||
+	    cairo_image_surface_get_height (golden) != height) {
+		g_printerr ("%s is %dx%d, the OSD renders %dx%d\n", path,
+			    cairo_image_surface_get_width (golden),
+			    cairo_image_surface_get_height (golden), width, height);
+		cairo_surface_destroy (golden);
+		return -1;
+	}
+
+	for (y = 0; y < height; y++) {
+		a = cairo_image_surface_get_data (surface) +
+		    y * cairo_image_surface_get_stride (surface);
+		b = cairo_image_surface_get_data (golden) +
+		    y * cairo_image_surface_get_stride (golden);
+		for (x = 0; x < width * 4; x += 4)
+			for (c = 0; c < 4; c++)
+				if (ABS (a[x + c] - b[x + c]) > GOLDEN_TOLERANCE) {
+					bad++;
+					break;
+				}
+	}
+
+	cairo_surface_destroy (golden);
+	return bad;
+}
+
+/* --render-png and --render-compare, the image is the same for both */
+static gint
+render_to_png (void)
+{
+	cairo_surface_t *surface;
+	cairo_status_t status;
+	gint scale = MAX (render_scale, 1);
+	gint bad = 0;
+
+	if (!parse_render_state (render_state ? render_state : "wlan=on,bt=on"))
+		return 1;
+
+	init_icons (scale);
+	surface = render_surface (scale);
+	render_frame (surface);
+
+	if (render_golden) {
+		bad = compare_golden (surface, render_golden);
+		if (bad > 0)
+			g_printerr ("%d pixels differ from %s\n", bad, render_golden);
+	}
+
+	if (render_png) {
+		status = cairo_surface_write_to_png (surface, render_png);
+		if (status != CAIRO_STATUS_SUCCESS) {
+			g_printerr ("Cannot write %s: %s\n", render_png,
+				    cairo_status_to_string (status));
+			bad = -1;
+		}
+	}
+	cairo_surface_destroy (surface);
+
+	return bad != 0;
+}
+
+/* times render_bench frames for every column count at 1x and 2x */
+static gint
+render_benchmark (void)
+{
+	static const gint scales[] = { 1, 2 };
+	cairo_surface_t *surface;
+	gint64 start, usec;
+	guint s, n, i;
+
+	for (i = 0; i < OSD_SLOTS; i++)
+		render_device (i, i % 2 ? RFKILL_TYPE_BLUETOOTH : RFKILL_TYPE_WLAN,
+			       i % 2, i % 2 ? "bt" : "wlan");
+
+	g_print ("%-6s %-8s %-10s %12s\n", "scale", "columns", "size", "us/frame");
+	for (s = 0; s < G_N_ELEMENTS (scales); s++) {
+		init_icons (scales[s]);
+		for (n = 1; n <= OSD_SLOTS; n++) {
+			n_devices = n;
+			surface = render_surface (scales[s]);
+
+			/* an untimed frame first, to warm the caches */
+			render_frame (surface);
+
+			start = g_get_monotonic_time ();
+			for (i = 0; i < (guint) render_bench; i++)
+				render_frame (surface);
+			usec = g_get_monotonic_time () - start;
+
+			g_print ("%-6d %-8u %4dx%-5d %12.1f\n", scales[s], n,
+				 cairo_image_surface_get_width (surface),
+				 cairo_image_surface_get_height (surface),
+				 (gdouble) usec / render_bench);
+
+			cairo_surface_destroy (surface);
+		}
+	}
 
 	return 0;
 }
 
+/* --render-png, --render-compare and --render-bench: no devices, no main loop */
+static gint
+render_offscreen (void)
+{
+	gint status;
+
+	g_setenv ("GTK_THEME", "grfkill", TRUE);
+	if (!gtk_init_check (NULL, NULL)) {
+		g_printerr ("Rendering the OSD needs a display, try xvfb-run\n");
+		return 1;
+	}
+	/* a switch synced while mapped would be caught mid-slide */
+	set_animations (FALSE);
+	if (!load_css ()) {
+		g_warning ("Failed to load css");
+		return 1;
+	}
+
+	offscreen = TRUE;
+	build_osd ();
+	gtk_widget_show_all (osd_window);
+
+	status = render_bench > 0 ? render_benchmark () : render_to_png ();
+	gtk_widget_destroy (osd_window);
+
+	return status;
+}
+
+/*
+ * --alloc-check: rescan and toggle the first slot @alloc_check times
+ * after two warm-up rounds and fail if that touched the heap. The counter
+ * comes from tests/alloc-count.so, which has to be preloaded. The echoed
+ * events are never dispatched, so only grfkill's own side is measured.
+ */
+static gint
+alloc_check_run (void)
+{
+	guint64 (*alloc_count) (void);
+	guint64 before;
+	guint64 scan = 0;
+	guint64 toggle = 0;
+	gint i;
+
+	alloc_count = (guint64 (*) (void)) dlsym (dlopen (NULL, RTLD_LAZY), "alloc_count");
+	if (alloc_count == NULL) {
+		g_printerr ("--alloc-check needs LD_PRELOAD=tests/alloc-count.so\n");
+		return 2;
+	}
+	if (!slots[0].bound) {
+		g_printerr ("--alloc-check needs a wlan or bluetooth device\n");
+		return 2;
+	}
+
+	/* one warm-up round each way sets up the sysfs dir stream, audit mutex... */
+	for (i = -2; i < alloc_check; i++) {
+		before = alloc_count ();
+		parse_directory ();
+		if (i >= 0)
+			scan += alloc_count () - before;
+
+		before = alloc_count ();
+		slot_toggle (&slots[0], i % 2 == 0);
+		if (i >= 0)
+			toggle += alloc_count () - before;
+	}
+
+	g_print ("allocations in %d scans: %" G_GUINT64_FORMAT "\n"
+		 "allocations in %d toggles: %" G_GUINT64_FORMAT "\n",
+		 alloc_check, scan, alloc_check, toggle);
+
+	return scan || toggle ? 1 : 0;
+}
+
+static void
+parse_option(gint *pargc, gchar **pargv[]){
+	GOptionContext *context;
+	GError *err = NULL;
+
+	GOptionEntry entries[] = {
+		{ "wlan", 'w', 0, G_OPTION_ARG_STRING_ARRAY, &wlan_selectors,
+			"select your wireless device by type, name glob or index (repeatable, comma separated)",
+			"acer-wireless" },
+		{ "bluetooth", 'b', 0, G_OPTION_ARG_STRING_ARRAY, &bt_selectors,
+			"select your bluetooth device by type, name glob or index (repeatable, comma separated)",
+			"acer-bluetooth" },
+		{ "resident", 'r', 0, G_OPTION_ARG_NONE, &resident,
+			"stay running hidden, publish radio state in shared memory and on the session bus; SIGUSR1 shows the OSD", NULL },
+		{ "latency", 'l', 0, G_OPTION_ARG_NONE, &latency,
+			"print the toggle latency histograms on exit (SIGUSR2 prints them any time)", NULL },
+		{ "metrics-file", 0, 0, G_OPTION_ARG_FILENAME, &metrics_file,
+			"write Prometheus metrics to this node-exporter textfile", "grfkill.prom" },
+		{ "duty-cycle", 0, 0, G_OPTION_ARG_NONE, &duty_cycle,
+			"summarize the blocked/unblocked time logged by --resident per day and device", NULL },
+		{ "idle-trim", 0, 0, G_OPTION_ARG_INT, &idle_trim,
+			"with --resident, drop the hidden OSD's widgets and icons after this many seconds (0 never)", "300" },
+		{ "hotkey", 'k', 0, G_OPTION_ARG_STRING_ARRAY, &hotkey_bindings,
+			"with --resident, grab this key on X11 (repeatable; action is wlan, bluetooth or all; \"none\" grabs nothing)", "wlan=XF86WLAN" },
+		{ "config", 0, 0, G_OPTION_ARG_FILENAME, &config_file,
+			"read selectors, icons and profiles from this file; --resident reloads it on change", "grfkill.conf" },
+		{ "fast-theme", 0, 0, G_OPTION_ARG_NONE, &fast_theme,
+			"skip the desktop theme and use the small built-in one (faster startup)", NULL },
+		{ "mem-report", 0, 0, G_OPTION_ARG_NONE, &memory_report,
+			"print the memory use of the running --resident instance", NULL },
+		{ "mem-budget", 0, 0, G_OPTION_ARG_INT, &memory_budget,
+			"map the OSD, print where its memory goes and fail if peak RSS exceeds this many kB (0 only reports)", "KB" },
+		{ "render-png", 0, 0, G_OPTION_ARG_FILENAME, &render_png,
+			"draw the OSD offscreen into this PNG with the built-in theme and exit (needs a display)", "osd.png" },
+		{ "state", 0, 0, G_OPTION_ARG_STRING, &render_state,
+			"radios for --render-png, type=on|off comma separated", "wlan=on,bt=off" },
+		{ "render-compare", 0, 0, G_OPTION_ARG_FILENAME, &render_golden,
+			"draw the OSD like --render-png and fail if it differs from this golden PNG", "golden.png" },
+		{ "render-scale", 0, 0, G_OPTION_ARG_INT, &render_scale,
+			"scale factor for --render-png", "1" },
+		{ "render-bench", 0, 0, G_OPTION_ARG_INT, &render_bench,
+			"time this many offscreen frames per scale and column count and exit", "N" },
+		{ "alloc-check", 0, G_OPTION_FLAG_HIDDEN, G_OPTION_ARG_INT, &alloc_check,
+			"rescan and toggle this many times, fail if that allocated (preload tests/alloc-count.so)", "N" },
+		{ NULL }
+	};
+
+	context = g_option_context_new ("");
+	g_option_context_add_main_entries (context, entries, NULL);
+	/* the display is opened later by gtk_init, so probing can overlap it */
+	g_option_context_add_group(context, gtk_get_option_group(FALSE));
+	if (!g_option_context_parse(context, pargc, pargv, &err)) {
+		g_print ("Failed to initialize: %s\n", err->message);
+		exit(0);
+	}
+
+	config = config_open (config_file);
+	compile_selectors (GRFKILL_CLASS_WLAN);
+	compile_selectors (GRFKILL_CLASS_BT);
+
+	if (metrics_file)
+		metrics_init (metrics_file);
+}
+
+int
+main (int argc, char *argv[])
+{
+	GtkSettings *settings;
+
+	GThread *probe_thread;
+	GError *err = NULL;
+	guint i;
+
+	profile_init ();
+
+	/* parse commandline options */
+	parse_option(&argc, &argv);
+
+	if (duty_cycle)
+		return duty_query ();
+	if (memory_report)
+		return mem_report ();
+	if (render_png || render_golden || render_bench > 0)
+		return render_offscreen ();
+
+	/* grfkill-resources.c answers for this theme; set before any thread runs */
+	if (fast_theme)
+		g_setenv ("GTK_THEME", "grfkill", TRUE);
+
+	/* initialize states and icons while gtk connects to the display */
+	probe_thread = g_thread_new ("probe", probe_thread_func, NULL);
+
+	gtk_init (&argc, &argv);
+	profile_mark ("gtk_init");
+
+	settings = gtk_settings_get_default ();
+	/* the built-in theme is dark already, don't make GTK look for a variant */
+	if (!fast_theme)
+		g_object_set (G_OBJECT (settings),
+			      "gtk-application-prefer-dark-theme", TRUE,
+			      NULL);
+
+	if (!load_css ()) {
+		g_warning ("Failed to load css");
+		return -1;
+	}
+	profile_mark ("theme");
+
+	g_thread_join (probe_thread);
+	if (profile_enabled)
+		g_printerr ("grfkill: %-14s %8.3f ms  (worker)\n", "probe",
+			    probe_usec / 1000.0);
+	profile_mark ("probe joined");
+
+	build_osd ();
+
+	audit_open ();
+
+	/* keep the switches in sync with hotkeys and other rfkill users */
+	rfkill_event_watch (rfkill_event_cb, NULL);
+
+	if (alloc_check > 0)
+		return alloc_check_run ();
+
+	g_unix_signal_add (SIGUSR2, latency_signal_cb, NULL);
+
+	if (resident) {
+		/* no caret in the OSD, but keep GTK from arming a blink timer */
+		g_object_set (G_OBJECT (settings),
+			      "gtk-cursor-blink", FALSE,
+			      NULL);
+		set_animations (FALSE);
+		default_poll = g_main_context_get_poll_func (NULL);
+		g_main_context_set_poll_func (NULL, counting_poll);
+
+		/* one resident per user, it owns the state file */
+		if (rfkill_shm_open () == -EBUSY) {
+			g_printerr ("grfkill --resident is already running, use SIGUSR1 to show it\n");
+			return 1;
+		}
+		rfkill_shm_publish (devices, n_devices);
+		duty_open ();
+		for (i = 0; i < n_devices; i++)
+			duty_record (&devices[i]);
+		rfkill_dbus_start (devices, &n_devices, set_device_blocked);
+		g_unix_signal_add (SIGUSR1, show_signal_cb, NULL);
+		g_unix_signal_add (SIGTERM, quit_signal_cb, NULL);
+		g_unix_signal_add (SIGINT, quit_signal_cb, NULL);
+		if (!hotkeys_bind (hotkey_bindings, hotkey_cb, &err)) {
+			g_printerr ("No hotkeys: %s\n", err->message);
+			g_clear_error (&err);
+		}
+		config_watch (config_changed_cb);
+		policy_start (devices, &n_devices, policy_apply_cb);
+		policy_load (config);
+		arm_trim ();
+	} else {
+		show_osd ();
+	}
+	profile_mark ("widgets");
+
+	gtk_main ();
+
+	finish ();
+	if (osd_window)
+		gtk_widget_destroy (osd_window);
+
+	return exit_status;
+}
+
 /* vim: set sts=4 sw=4 ts=4: */
@@ -0,0 +1,197 @@
+/**
+ * Global hotkeys for the resident OSD.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * Instead of having the window manager spawn a new grfkill for every
+ * XF86WLAN press, the resident process grabs the keys on the root
+ * window with XGrabKey and handles the KeyPress itself. Bindings are
+ * "action=accelerator" strings, e.g. "wlan=XF86WLAN" or
+ * "bluetooth=<Super>b", with the accelerator in gtk_accelerator_parse
+ * syntax, and "none" grabs nothing. Each key is grabbed once per
+ * Lock/NumLock combination so the lock state does not get in the way.
+ * Only X11 is supported; on other displays binding fails and the window
+ * manager path keeps working.
+ */
+
+#include <gtk/gtk.h>
+#include <gdk/gdkx.h>
+#include <X11/Xlib.h>
+#include <string.h>
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+
+typedef struct {
+	guint   action;		/* HOTKEY_* */
+	KeyCode keycode;
+	guint   modifiers;
+} Hotkey;
+
+static const gchar *const action_names[N_HOTKEY_ACTIONS] = {
+	[HOTKEY_WLAN]      = "wlan",
+	[HOTKEY_BLUETOOTH] = "bluetooth",
+	[HOTKEY_ALL]       = "all",
+};
+
+static const gchar *const default_bindings[] = {
+	"wlan=XF86WLAN",
+	"bluetooth=XF86Bluetooth",
+	"all=XF86RFKill",
+	NULL
+};
+
+/* grabbed in every combination, ignored when matching */
+static const guint lock_masks[] = {
+	0, LockMask, Mod2Mask, LockMask | Mod2Mask
+};
+
+static Hotkey hotkeys[HOTKEY_MAX];
+static guint n_hotkeys = 0;
+static HotkeyFunc hotkey_func;
+
+static GdkFilterReturn
+hotkey_filter (GdkXEvent *gdk_xevent,
+	       GdkEvent  *event,
+	       gpointer   data)
+{
+	XEvent *xevent = gdk_xevent;
+	guint state;
+	guint i;
+
+	if (xevent->type != KeyPress)
+		return GDK_FILTER_CONTINUE;
+
+	state = xevent->xkey.state & ~(LockMask | Mod2Mask);
+	for (i = 0; i < n_hotkeys; i++) {
+		if (hotkeys[i].keycode == xevent->xkey.keycode &&
+		    hotkeys[i].modifiers == state) {
+			rfkill_shm_wakeup (GRFKILL_WAKEUP_HOTKEY);
+			hotkey_func (hotkeys[i].action);
+			return GDK_FILTER_REMOVE;
+		}
+	}
+
+	return GDK_FILTER_CONTINUE;
+}
+
+static gboolean
+parse_binding (const gchar  *binding,
+	       Hotkey       *key,
+	       GError      **error)
+{
+	const gchar *accel = strchr (binding, '=');
+	gchar *action;
+	GdkModifierType mods;
+	guint keyval;
+	guint i;
+
+	if (accel == NULL) {
+		g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+			     "hotkey \"%s\" is not action=key", binding);
+		return FALSE;
+	}
+
+	action = g_strndup (binding, accel - binding);
+	for (i = 0; i < N_HOTKEY_ACTIONS; i++)
+		if (g_ascii_strcasecmp (action, action_names[i]) == 0)
+			break;
+	g_free (action);
+	if (i == N_HOTKEY_ACTIONS) {
+		g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+			     "unknown hotkey action in \"%s\", use wlan, bluetooth or all",
+			     binding);
+		return FALSE;
+	}
+
+	gtk_accelerator_parse (accel + 1, &keyval, &mods);
+	if (keyval == 0) {
+		g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+			     "unknown key in hotkey \"%s\"", binding);
+		return FALSE;
+	}
+
+	/* turn <Super> and friends into the Mod bits the server reports */
+	gdk_keymap_map_virtual_modifiers (gdk_keymap_get_default (), &mods);
+
+	key->action = i;
+	key->keycode = XKeysymToKeycode (gdk_x11_get_default_xdisplay (), keyval);
+	key->modifiers = mods & (ShiftMask | ControlMask | Mod1Mask |
+				 Mod3Mask | Mod4Mask | Mod5Mask);
+	if (key->keycode == 0) {
+		g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+			     "no key on this keyboard produces \"%s\"", accel + 1);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/* NULL bindings grab the XF86WLAN, XF86Bluetooth and XF86RFKill keys */
+gboolean
+hotkeys_bind (gchar      **bindings,
+	      HotkeyFunc   func,
+	      GError     **error)
+{
+	const gchar *const *binding;
+	const gchar *names[HOTKEY_MAX];
+	Hotkey parsed[HOTKEY_MAX];
+	GdkDisplay *display = gdk_display_get_default ();
+	Display *xdisplay;
+	Window root;
+	Hotkey *key;
+	guint n_parsed = 0;
+	guint i;
+	guint k;
+
+	if (!GDK_IS_X11_DISPLAY (display)) {
+		g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_FAILED,
+			     "global hotkeys need an X11 display");
+		return FALSE;
+	}
+
+	xdisplay = GDK_DISPLAY_XDISPLAY (display);
+	root = DefaultRootWindow (xdisplay);
+	hotkey_func = func;
+
+	binding = bindings ? (const gchar *const *) bindings : default_bindings;
+	if (g_strcmp0 (*binding, "none") == 0)
+		return TRUE;
+
+	/* all or nothing: a bad binding must not leave the earlier ones grabbed */
+	for (; *binding; binding++) {
+		if (n_parsed == HOTKEY_MAX) {
+			g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+				     "too many hotkeys, at most %d can be bound", HOTKEY_MAX);
+			return FALSE;
+		}
+		if (!parse_binding (*binding, &parsed[n_parsed], error))
+			return FALSE;
+		names[n_parsed++] = *binding;
+	}
+
+	for (k = 0; k < n_parsed; k++) {
+		key = &parsed[k];
+		gdk_x11_display_error_trap_push (display);
+		for (i = 0; i < G_N_ELEMENTS (lock_masks); i++)
+			XGrabKey (xdisplay, key->keycode, key->modifiers | lock_masks[i],
+				  root, False, GrabModeAsync, GrabModeAsync);
+		if (gdk_x11_display_error_trap_pop (display)) {
+			/* usually the window manager still binds it to spawn us */
+			g_warning ("hotkey \"%s\" is grabbed by another client", names[k]);
+			/* drop the lock combinations that did get grabbed */
+			gdk_x11_display_error_trap_push (display);
+			for (i = 0; i < G_N_ELEMENTS (lock_masks); i++)
+				XUngrabKey (xdisplay, key->keycode,
+					    key->modifiers | lock_masks[i], root);
+			gdk_x11_display_error_trap_pop_ignored (display);
+			continue;
+		}
+		hotkeys[n_hotkeys++] = *key;
+	}
+
+	if (n_hotkeys > 0)
+		gdk_window_add_filter (NULL, hotkey_filter, NULL);
+
+	return TRUE;
+}
@@ -0,0 +1,275 @@
+/**
+ * Icon masks rasterized from the shipped SVGs at the exact device size.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * The SVGs are compiled in as resources. Only their coverage is kept:
+ * the OSD tints each mask with theme colours when it draws. The first
+ * time a mask is needed at a size and scale it is rendered with
+ * gdk-pixbuf's SVG loader and written to $XDG_CACHE_HOME/grfkill as
+ * CAIRO_FORMAT_A8, in a file named after the SVG's hash, the size and the
+ * scale. Later launches mmap that file and hand the pages to cairo as
+ * they are, so nothing is decoded or scaled. Entries for an older SVG
+ * are never looked at again.
+ *
+ * Rendering needs librsvg's gdk-pixbuf loader at runtime, which is only
+ * looked for here: without it the glyphs are left out with a warning.
+ */
+
+#include <gtk/gtk.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+#include "grfkill.h"
+
+#define ICON_RESOURCE_PATH "/org/grfkill/icons/"
+#define ICON_CACHE_MAGIC   0x69667267	/* "grfi" */
+
+/* followed by height rows of stride bytes, CAIRO_FORMAT_A8 */
+typedef struct {
+	guint32 magic;
+	guint32 width;
+	guint32 height;
+	guint32 stride;
+} IconCacheHeader;
+
+typedef struct {
+	gpointer addr;
+	gsize    len;
+} IconMapping;
+
+static const cairo_user_data_key_t mapping_key;
+
+static void
+unmap_cb (gpointer data)
+{
+	IconMapping *mapping = data;
+
+	munmap (mapping->addr, mapping->len);
+	g_free (mapping);
+}
+
+/* width and height in device pixels */
+static cairo_surface_t *
+map_cached (const gchar *path, gint width, gint height, gint scale)
+{
+	cairo_surface_t *surface;
+	IconCacheHeader *header;
+	IconMapping *mapping;
+	struct stat st;
+	gint stride = cairo_format_stride_for_width (CAIRO_FORMAT_A8, width);
+	gsize len = sizeof (IconCacheHeader) + (gsize) stride * height;
+	gpointer addr;
+	int fd;
+
+	fd = open (path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return NULL;
+	if (fstat (fd, &st) < 0 || st.st_size != (off_t) len) {
+		close (fd);
+		return NULL;
+	}
+
+	/* writable for cairo's sake; the pages stay shared unless written */
+	addr = mmap (NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close (fd);
+	if (addr == MAP_FAILED)
+		return NULL;
+
+	header = addr;
+	if (header->magic != ICON_CACHE_MAGIC ||
+	    header->width != (guint32) width ||
+	    header->height != (guint32) height ||
+	    header->stride != (guint32) stride) {
+		munmap (addr, len);
+		return NULL;
+	}
+
+	surface = cairo_image_surface_create_for_data ((guchar *) addr + sizeof (IconCacheHeader),
+						       CAIRO_FORMAT_A8,
+						       width, height, stride);
+	mapping = g_new (IconMapping, 1);
+	mapping->addr = addr;
+	mapping->len = len;
+	if (cairo_surface_set_user_data (surface, &mapping_key, mapping, unmap_cb) != CAIRO_STATUS_SUCCESS) {
+		cairo_surface_destroy (surface);
+		unmap_cb (mapping);
+		return NULL;
+	}
+	cairo_surface_set_device_scale (surface, scale, scale);
+
+	return surface;
+}
+
+/* g_file_set_contents renames into place, so readers never see half a file */
+static void
+write_cached (const gchar *path, cairo_surface_t *surface)
+{
+	IconCacheHeader header;
+	const guchar *data;
+	gchar *contents;
+	gsize len;
+	gint stride;
+	gint y;
+
+	cairo_surface_flush (surface);
+	header.magic = ICON_CACHE_MAGIC;
+	header.width = cairo_image_surface_get_width (surface);
+	header.height = cairo_image_surface_get_height (surface);
+	header.stride = cairo_format_stride_for_width (CAIRO_FORMAT_A8, header.width);
+
+	len = sizeof (header) + (gsize) header.stride * header.height;
+	contents = g_malloc (len);
+	memcpy (contents, &header, sizeof (header));
+
+	data = cairo_image_surface_get_data (surface);
+	stride = cairo_image_surface_get_stride (surface);
+	for (y = 0; y < (gint) header.height; y++)
+		memcpy (contents + sizeof (header) + (gsize) y * header.stride,
+			data + (gsize) y * stride, header.stride);
+
+	g_file_set_contents (path, contents, len, NULL);
+	g_free (contents);
+}
+
+static cairo_surface_t *
+render_svg (GBytes *svg, gint width, gint height, gint scale)
+{
+	cairo_surface_t *surface;
+	GInputStream *stream;
+	GdkPixbuf *pixbuf;
+	const guchar *pixels;
+	guchar *data;
+	gboolean has_alpha;
+	gint n_channels;
+	gint rowstride;
+	gint stride;
+	gint x, y;
+
+	stream = g_memory_input_stream_new_from_bytes (svg);
+	pixbuf = gdk_pixbuf_new_from_stream_at_scale (stream, width, height, FALSE, NULL, NULL);
+	g_object_unref (stream);
+	if (pixbuf == NULL)
+		return NULL;
+
+	if (gdk_pixbuf_get_width (pixbuf) != width ||
+	    gdk_pixbuf_get_height (pixbuf) != height) {
+		g_object_unref (pixbuf);
+		return NULL;
+	}
+
+	/* keep the alpha channel only */
+	surface = cairo_image_surface_create (CAIRO_FORMAT_A8, width, height);
+	data = cairo_image_surface_get_data (surface);
+	stride = cairo_image_surface_get_stride (surface);
+	pixels = gdk_pixbuf_read_pixels (pixbuf);
+	rowstride = gdk_pixbuf_get_rowstride (pixbuf);
+	n_channels = gdk_pixbuf_get_n_channels (pixbuf);
+	has_alpha = gdk_pixbuf_get_has_alpha (pixbuf);
+	for (y = 0; y < height; y++)
+		for (x = 0; x < width; x++)
+			data[y * stride + x] = has_alpha ?
+				pixels[y * rowstride + x * n_channels + 3] : 0xff;
+	cairo_surface_mark_dirty (surface);
+	cairo_surface_set_device_scale (surface, scale, scale);
+	g_object_unref (pixbuf);
+
+	return surface;
+}
+
+/* without librsvg's gdk-pixbuf loader every mask would come out empty */
+static gboolean
+have_svg_loader (void)
+{
+	static gint have = -1;
+	GSList *formats;
+	GSList *l;
+
+	if (have >= 0)
+		return have;
+
+	have = 0;
+	formats = gdk_pixbuf_get_formats ();
+	for (l = formats; l; l = l->next)
+		if (g_strcmp0 (gdk_pixbuf_format_get_name (l->data), "svg") == 0)
+			have = 1;
+	g_slist_free (formats);
+
+	if (!have)
+		g_warning ("gdk-pixbuf has no SVG loader, install librsvg's to get the OSD icons");
+
+	return have;
+}
+
+/*
+ * The mask of "name" (name.svg in the repo, or the SVG at path when not
+ * NULL) at width x height logical pixels for a scale factor, or NULL if
+ * it cannot be read or rendered, e.g. without the librsvg pixbuf loader.
+ */
+cairo_surface_t *
+icon_cache_load (const gchar *name,
+		 const gchar *path,
+		 gint         width,
+		 gint         height,
+		 gint         scale)
+{
+	cairo_surface_t *surface;
+	GBytes *svg;
+	gchar *resource;
+	gchar *hash;
+	gchar *dir;
+	gchar *file;
+	gchar *cached;
+	gchar *contents;
+	gsize len;
+
+	if (path) {
+		if (!g_file_get_contents (path, &contents, &len, NULL))
+			return NULL;
+		svg = g_bytes_new_take (contents, len);
+	} else {
+		resource = g_strconcat (ICON_RESOURCE_PATH, name, ".svg", NULL);
+		svg = g_resources_lookup_data (resource, G_RESOURCE_LOOKUP_FLAGS_NONE, NULL);
+		g_free (resource);
+		if (svg == NULL)
+			return NULL;
+	}
+
+	hash = g_compute_checksum_for_bytes (G_CHECKSUM_SHA256, svg);
+	dir = g_build_filename (g_get_user_cache_dir (), "grfkill", NULL);
+	file = g_strdup_printf ("%s-%.16s-%dx%d@%d.a8", name, hash,
+				width, height, scale);
+	cached = g_build_filename (dir, file, NULL);
+
+	surface = map_cached (cached, width * scale, height * scale, scale);
+	if (surface == NULL && have_svg_loader ()) {
+		surface = render_svg (svg, width * scale, height * scale, scale);
+		if (surface && g_mkdir_with_parents (dir, 0700) == 0)
+			write_cached (cached, surface);
+	}
+
+	g_free (cached);
+	g_free (file);
+	g_free (dir);
+	g_free (hash);
+	g_bytes_unref (svg);
+
+	return surface;
+}
+
+/* bytes the SVG takes in the binary, for --mem-budget */
+gsize
+icon_cache_svg_size (const gchar *name)
+{
+	gchar *resource;
+	gsize size = 0;
+
+	resource = g_strconcat (ICON_RESOURCE_PATH, name, ".svg", NULL);
+	g_resources_get_info (resource, G_RESOURCE_LOOKUP_FLAGS_NONE, &size, NULL, NULL);
+	g_free (resource);
+
+	return size;
+}
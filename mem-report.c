@@ -0,0 +1,215 @@
+/**
+ * Memory footprint of the resident grfkill.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * "grfkill --mem-report" finds the resident process through the state
+ * file and prints its memory use as the kernel accounts it. Anonymous
+ * and private dirty pages are what the idle trim can give back. File
+ * backed pages are mostly library text shared with other GTK clients.
+ *
+ * "grfkill --mem-budget KB" measures the process itself once the OSD is
+ * mapped: peak RSS, private dirty pages and heap in use, with the
+ * resident pages split by where they come from. It exits non-zero when
+ * the peak is over the budget, so growth shows up in a scripted run.
+ */
+
+#include <glib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+
+static const gchar *status_keys[] = {
+	"VmHWM", "VmRSS", "RssAnon", "RssFile", "RssShmem", "VmData", NULL
+};
+
+static const gchar *rollup_keys[] = {
+	"Pss", "Private_Clean", "Private_Dirty", "Shared_Clean", NULL
+};
+
+/* prints the "Key:   123 kB" lines of a /proc file that are in keys */
+static gboolean
+print_fields (const gchar *path, const gchar **keys)
+{
+	gchar *contents;
+	gchar **lines;
+	gchar **line;
+	const gchar **key;
+	gsize len;
+
+	if (!g_file_get_contents (path, &contents, NULL, NULL))
+		return FALSE;
+
+	lines = g_strsplit (contents, "\n", -1);
+	for (key = keys; *key; key++) {
+		len = strlen (*key);
+		for (line = lines; *line; line++) {
+			if (strncmp (*line, *key, len) == 0 && (*line)[len] == ':') {
+				g_print ("%-14s %s\n", *key, g_strstrip (*line + len + 1));
+				break;
+			}
+		}
+	}
+
+	g_strfreev (lines);
+	g_free (contents);
+	return TRUE;
+}
+
+enum {
+	REGION_SELF,	/* our text, data and bss, the embedded icons included */
+	REGION_HEAP,
+	REGION_FILES,	/* GTK and the other libraries, theme and cache files */
+	REGION_ANON,	/* anonymous maps: large allocations, stacks */
+	N_REGIONS
+};
+
+static const gchar *region_names[N_REGIONS] = {
+	"grfkill image", "heap", "libraries/theme", "anonymous"
+};
+
+/* sums Rss and Private_Dirty of /proc/self/smaps per region, in kB */
+static gboolean
+scan_smaps (guint64 rss[N_REGIONS], guint64 dirty[N_REGIONS])
+{
+	gchar *self;
+	gchar line[512];
+	gchar *path;
+	guint region = REGION_ANON;
+	guint64 kb;
+	gint offset;
+	FILE *f;
+
+	f = fopen ("/proc/self/smaps", "r");
+	if (f == NULL)
+		return FALSE;
+
+	self = g_file_read_link ("/proc/self/exe", NULL);
+	while (fgets (line, sizeof (line), f)) {
+		offset = 0;
+		if (sscanf (line, "%*x-%*x %*s %*x %*s %*u %n", &offset) >= 0 &&
+		    offset > 0) {
+			path = g_strchomp (line + offset);
+			if (self && strcmp (path, self) == 0)
+				region = REGION_SELF;
+			else if (strcmp (path, "[heap]") == 0)
+				region = REGION_HEAP;
+			else if (path[0] == '/')
+				region = REGION_FILES;
+			else
+				region = REGION_ANON;
+		} else if (sscanf (line, "Rss: %" G_GUINT64_FORMAT, &kb) == 1) {
+			rss[region] += kb;
+		} else if (sscanf (line, "Private_Dirty: %" G_GUINT64_FORMAT, &kb) == 1) {
+			dirty[region] += kb;
+		}
+	}
+
+	g_free (self);
+	fclose (f);
+	return TRUE;
+}
+
+/* the "VmHWM:  1234 kB" style line of /proc/self/status, in kB */
+static guint64
+status_kb (const gchar *key)
+{
+	gchar line[256];
+	guint64 kb = 0;
+	gsize len = strlen (key);
+	FILE *f;
+
+	f = fopen ("/proc/self/status", "r");
+	if (f == NULL)
+		return 0;
+
+	while (fgets (line, sizeof (line), f))
+		if (strncmp (line, key, len) == 0 && line[len] == ':') {
+			sscanf (line + len + 1, "%" G_GUINT64_FORMAT, &kb);
+			break;
+		}
+
+	fclose (f);
+	return kb;
+}
+
+gboolean
+mem_budget (gsize icon_bytes,
+	    gsize raster_bytes,
+	    gint  budget_kb)
+{
+	guint64 rss[N_REGIONS] = { 0 };
+	guint64 dirty[N_REGIONS] = { 0 };
+	guint64 now = status_kb ("VmRSS");
+	guint64 peak = MAX (status_kb ("VmHWM"), now);
+	guint64 heap = 0;
+	guint i;
+#if defined (__GLIBC__) && __GLIBC_PREREQ (2, 33)
+	struct mallinfo2 mi = mallinfo2 ();
+
+	/* large pixbufs are mmapped by malloc and only show up in hblkhd */
+	heap = mi.uordblks + mi.hblkhd;
+#endif
+
+	if (!scan_smaps (rss, dirty)) {
+		g_printerr ("Cannot read /proc/self/smaps\n");
+		return FALSE;
+	}
+
+	g_print ("%-18s %8" G_GUINT64_FORMAT " kB\n", "peak rss", peak);
+	g_print ("%-18s %8" G_GUINT64_FORMAT " kB\n", "rss", now);
+	g_print ("%-18s %8" G_GUINT64_FORMAT " kB\n", "heap in use", heap / 1024);
+	g_print ("%-18s %8" G_GSIZE_FORMAT " kB  (in grfkill image)\n",
+		 "embedded icons", icon_bytes / 1024);
+	g_print ("%-18s %8" G_GSIZE_FORMAT " kB  (heap, or mapped from the cache)\n",
+		 "icon rasters", raster_bytes / 1024);
+
+	g_print ("\n%-18s %8s    %8s\n", "region", "rss", "dirty");
+	for (i = 0; i < N_REGIONS; i++)
+		g_print ("%-18s %8" G_GUINT64_FORMAT " kB %8" G_GUINT64_FORMAT " kB\n",
+			 region_names[i], rss[i], dirty[i]);
+
+	if (budget_kb > 0 && peak > (guint64) budget_kb) {
+		g_printerr ("grfkill: peak rss %" G_GUINT64_FORMAT " kB is over the %d kB budget\n",
+			    peak, budget_kb);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+gint
+mem_report (void)
+{
+	const struct grfkill_state *map;
+	struct grfkill_state snap;
+	gchar path[64];
+
+	map = grfkill_state_map ();
+	if (map == NULL || grfkill_state_snapshot (map, &snap) < 0 ||
+	    !grfkill_state_alive (&snap)) {
+		g_printerr ("No resident grfkill is running\n");
+		grfkill_state_unmap (map);
+		return 1;
+	}
+	grfkill_state_unmap (map);
+
+	g_print ("%-14s %d\n", "pid", snap.pid);
+
+	g_snprintf (path, sizeof (path), "/proc/%d/status", snap.pid);
+	if (!print_fields (path, status_keys)) {
+		g_printerr ("Cannot read %s\n", path);
+		return 1;
+	}
+
+	/* smaps_rollup needs Linux 4.14, the status lines are enough without */
+	g_snprintf (path, sizeof (path), "/proc/%d/smaps_rollup", snap.pid);
+	print_fields (path, rollup_keys);
+
+	return 0;
+}
@@ -0,0 +1,297 @@
+/**
+ * Prometheus textfile metrics for node-exporter.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * With --metrics-file the counters below are rewritten atomically (temp
+ * file + rename) after they change, at most once per second: a change
+ * sets the ready time of one long-lived source to the end of the current
+ * second, so an idle grfkill never wakes up for metrics and counting a
+ * toggle does not allocate.
+ */
+
+#include <glib.h>
+#include <string.h>
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+
+#define FLUSH_INTERVAL_USEC G_USEC_PER_SEC
+#define N_OPS               (RFKILL_OP_CHANGE_ALL + 1)
+
+static const gchar *const op_names[N_OPS] = {
+	[RFKILL_OP_ADD]        = "add",
+	[RFKILL_OP_DEL]        = "del",
+	[RFKILL_OP_CHANGE]     = "change",
+	[RFKILL_OP_CHANGE_ALL] = "change_all",
+};
+
+typedef struct {
+	guint32 idx;
+	guint8  type;
+	gboolean blocked;
+	gint64  blocked_since;
+	gint64  blocked_usec;
+	gchar   name[GRFKILL_NAME_LEN];
+} DeviceMetrics;
+
+static gchar *metrics_path = NULL;
+static GSource *flush_source = NULL;
+static gint64 last_flush = 0;
+
+static guint64 toggles[NUM_RFKILL_TYPES][2];	/* [type][ok] */
+static guint64 write_failures = 0;
+static guint64 events[N_OPS];
+static gint64  startup_usec = -1;
+static guint64 repaints = 0;
+static guint64 fades = 0;
+static guint64 fade_frames = 0;
+static guint64 fade_repaints = 0;
+
+static DeviceMetrics device_metrics[GRFKILL_MAX_DEVICES];
+static guint n_device_metrics = 0;
+
+static void
+append_device_labels (GString *out, const DeviceMetrics *dev)
+{
+	const gchar *c;
+
+	g_string_append_printf (out, "{index=\"%u\",type=\"%s\",name=\"",
+				dev->idx, rfkill_type_name (dev->type));
+	/* label values escape backslash, quote and newline */
+	for (c = dev->name; *c; c++) {
+		if (*c == '\\' || *c == '"')
+			g_string_append_c (out, '\\');
+		if (*c == '\n')
+			g_string_append (out, "\\n");
+		else
+			g_string_append_c (out, *c);
+	}
+	g_string_append (out, "\"}");
+}
+
+static void
+metrics_flush (void)
+{
+	GString *out;
+	GError *err = NULL;
+	const DeviceMetrics *dev;
+	gint64 now = g_get_monotonic_time ();
+	gint64 blocked;
+	guint type;
+	guint op;
+
+	out = g_string_sized_new (2048);
+
+	g_string_append (out,
+		"# HELP grfkill_toggles_total Block/unblock writes by rfkill type and result.\n"
+		"# TYPE grfkill_toggles_total counter\n");
+	for (type = 0; type < NUM_RFKILL_TYPES; type++) {
+		if (toggles[type][TRUE] + toggles[type][FALSE] == 0)
+			continue;
+		g_string_append_printf (out,
+			"grfkill_toggles_total{type=\"%s\",result=\"ok\"} %" G_GUINT64_FORMAT "\n"
+			"grfkill_toggles_total{type=\"%s\",result=\"failed\"} %" G_GUINT64_FORMAT "\n",
+			rfkill_type_name (type), toggles[type][TRUE],
+			rfkill_type_name (type), toggles[type][FALSE]);
+	}
+
+	g_string_append_printf (out,
+		"# HELP grfkill_write_failures_total Block/unblock writes that failed.\n"
+		"# TYPE grfkill_write_failures_total counter\n"
+		"grfkill_write_failures_total %" G_GUINT64_FORMAT "\n",
+		write_failures);
+
+	g_string_append (out,
+		"# HELP grfkill_events_total /dev/rfkill events by operation.\n"
+		"# TYPE grfkill_events_total counter\n");
+	for (op = 0; op < N_OPS; op++)
+		g_string_append_printf (out, "grfkill_events_total{op=\"%s\"} %" G_GUINT64_FORMAT "\n",
+					op_names[op], events[op]);
+
+	if (startup_usec >= 0)
+		g_string_append_printf (out,
+			"# HELP grfkill_startup_seconds Time from exec to the first OSD frame.\n"
+			"# TYPE grfkill_startup_seconds gauge\n"
+			"grfkill_startup_seconds %.6f\n",
+			startup_usec / (gdouble) G_USEC_PER_SEC);
+
+	g_string_append_printf (out,
+		"# HELP grfkill_repaints_total Frames the OSD window was drawn by grfkill.\n"
+		"# TYPE grfkill_repaints_total counter\n"
+		"grfkill_repaints_total %" G_GUINT64_FORMAT "\n"
+		"# HELP grfkill_fades_total Completed fade-ins and fade-outs.\n"
+		"# TYPE grfkill_fades_total counter\n"
+		"grfkill_fades_total %" G_GUINT64_FORMAT "\n"
+		"# HELP grfkill_fade_frames_total Frame clock ticks spent fading.\n"
+		"# TYPE grfkill_fade_frames_total counter\n"
+		"grfkill_fade_frames_total %" G_GUINT64_FORMAT "\n"
+		"# HELP grfkill_fade_repaints_total Repaints while fading; the compositor blends, so 0.\n"
+		"# TYPE grfkill_fade_repaints_total counter\n"
+		"grfkill_fade_repaints_total %" G_GUINT64_FORMAT "\n",
+		repaints, fades, fade_frames, fade_repaints);
+
+	g_string_append (out,
+		"# HELP grfkill_device_blocked Whether the device is soft or hard blocked.\n"
+		"# TYPE grfkill_device_blocked gauge\n");
+	for (dev = device_metrics; dev < device_metrics + n_device_metrics; dev++) {
+		g_string_append (out, "grfkill_device_blocked");
+		append_device_labels (out, dev);
+		g_string_append_printf (out, " %d\n", dev->blocked);
+	}
+
+	g_string_append (out,
+		"# HELP grfkill_device_blocked_seconds_total Time the device spent blocked.\n"
+		"# TYPE grfkill_device_blocked_seconds_total counter\n");
+	for (dev = device_metrics; dev < device_metrics + n_device_metrics; dev++) {
+		blocked = dev->blocked_usec;
+		if (dev->blocked)
+			blocked += now - dev->blocked_since;
+		g_string_append (out, "grfkill_device_blocked_seconds_total");
+		append_device_labels (out, dev);
+		g_string_append_printf (out, " %.3f\n", blocked / (gdouble) G_USEC_PER_SEC);
+	}
+
+	if (!g_file_set_contents (metrics_path, out->str, out->len, &err)) {
+		g_warning ("Failed to write metrics: %s", err->message);
+		g_error_free (err);
+	}
+	g_string_free (out, TRUE);
+
+	last_flush = now;
+}
+
+static gboolean
+flush_dispatch (GSource     *source,
+		GSourceFunc  callback,
+		gpointer     user_data)
+{
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_METRICS);
+	g_source_set_ready_time (source, -1);
+	metrics_flush ();
+
+	return G_SOURCE_CONTINUE;
+}
+
+static GSourceFuncs flush_funcs = {
+	NULL, NULL, flush_dispatch, NULL
+};
+
+static void
+metrics_changed (void)
+{
+	if (metrics_path == NULL || g_source_get_ready_time (flush_source) != -1)
+		return;
+
+	g_source_set_ready_time (flush_source,
+				 MAX (last_flush + FLUSH_INTERVAL_USEC,
+				      g_get_monotonic_time ()));
+}
+
+void
+metrics_init (const gchar *path)
+{
+	metrics_path = g_strdup (path);
+
+	flush_source = g_source_new (&flush_funcs, sizeof (GSource));
+	g_source_attach (flush_source, NULL);
+}
+
+void
+metrics_write (guint8 type, gboolean ok)
+{
+	toggles[MIN (type, NUM_RFKILL_TYPES - 1)][ok != FALSE]++;
+	if (!ok)
+		write_failures++;
+	metrics_changed ();
+}
+
+void
+metrics_event (guint8 op)
+{
+	if (op < N_OPS)
+		events[op]++;
+	metrics_changed ();
+}
+
+void
+metrics_startup (gint64 usec)
+{
+	startup_usec = usec;
+	metrics_changed ();
+}
+
+void
+metrics_repaint (void)
+{
+	repaints++;
+	metrics_changed ();
+}
+
+void
+metrics_fade (guint frames, guint repainted)
+{
+	fades++;
+	fade_frames += frames;
+	fade_repaints += repainted;
+	metrics_changed ();
+}
+
+void
+metrics_device (const RfkillDevice *dev)
+{
+	DeviceMetrics *m;
+	gboolean blocked = dev->soft || dev->hard;
+	gint64 now = g_get_monotonic_time ();
+
+	for (m = device_metrics; m < device_metrics + n_device_metrics; m++)
+		if (m->idx == dev->idx)
+			break;
+
+	if (m == device_metrics + n_device_metrics) {
+		if (n_device_metrics == GRFKILL_MAX_DEVICES)
+			return;
+		n_device_metrics++;
+		memset (m, 0, sizeof (DeviceMetrics));
+		m->idx = dev->idx;
+	} else if (m->blocked == blocked) {
+		return;
+	}
+
+	if (m->blocked)
+		m->blocked_usec += now - m->blocked_since;
+	m->type = dev->type;
+	m->blocked = blocked;
+	m->blocked_since = now;
+	g_strlcpy (m->name, dev->name, sizeof (m->name));
+
+	metrics_changed ();
+}
+
+/* the device was removed, stop exporting it */
+void
+metrics_device_gone (guint32 idx)
+{
+	DeviceMetrics *m;
+
+	for (m = device_metrics; m < device_metrics + n_device_metrics; m++)
+		if (m->idx == idx)
+			break;
+
+	if (m == device_metrics + n_device_metrics)
+		return;
+
+	*m = device_metrics[--n_device_metrics];
+	metrics_changed ();
+}
+
+/* write out whatever is still pending, e.g. before exiting */
+void
+metrics_sync (void)
+{
+	if (metrics_path == NULL)
+		return;
+
+	g_source_set_ready_time (flush_source, -1);
+	metrics_flush ();
+}
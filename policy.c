@@ -0,0 +1,803 @@
+/**
+ * Radio policy rules, each evaluated only when one of its inputs changes.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * [Rule NAME] groups in the config file pair a trigger with an action:
+ *
+ *	when=wwan blocked		every radio of the type is (un)blocked
+ *	when=wlan connected		a wireless interface is operationally up
+ *	when=bluetooth idle 10m		unblocked with no connection for 10 minutes
+ *	when=lid closed			the lid switch of an input device
+ *	at=09:00			every day, local time
+ *
+ *	do=block wwan | unblock all | profile office
+ *
+ * A rule fires when its trigger becomes true, not while it stays true;
+ * what is already true when it is loaded does not count as becoming so.
+ * The inputs are the /dev/rfkill events grfkill reads anyway, an
+ * rtnetlink socket for link state, a udev monitor socket for Bluetooth
+ * connections and the evdev node of the lid switch, each opened only once
+ * a rule needs it. Like libudev, the monitor socket carries a BPF filter
+ * on udevd's subsystem hash, so other devices' events never wake us. Idle
+ * and daily deadlines share one CLOCK_REALTIME timerfd armed for the
+ * earliest of them, which the kernel also wakes when the clock is set.
+ * Nothing is polled. What the rules of one pass want is merged, later
+ * rules winning, and handed over as one batch.
+ */
+
+#define _GNU_SOURCE
+
+#include <glib.h>
+#include <glib-unix.h>
+#include <linux/filter.h>
+#include <linux/input.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+
+#define MAX_UP_LINKS  16
+#define BITS_PER_LONG (sizeof (gulong) * 8)
+
+#define UDEV_MONITOR_GROUP 2		/* udevd's events, not the kernel's */
+#define UDEV_MONITOR_MAGIC 0xfeedcafe
+
+/* what a trigger depends on, so a change only re-evaluates its rules */
+enum {
+	INPUT_RADIO = 1 << 0,
+	INPUT_LINK  = 1 << 1,
+	INPUT_BT    = 1 << 2,
+	INPUT_LID   = 1 << 3,
+	INPUT_ALL   = INPUT_RADIO | INPUT_LINK | INPUT_BT | INPUT_LID,
+	INPUT_TIMER = 1 << 4	/* deadlines, checked by timer_cb only */
+};
+
+static const guint trigger_inputs[] = {
+	[RULE_STATE]     = INPUT_RADIO,
+	[RULE_CONNECTED] = INPUT_LINK,
+	[RULE_IDLE]      = INPUT_RADIO | INPUT_BT | INPUT_TIMER,
+	[RULE_LID]       = INPUT_LID,
+	[RULE_AT]        = INPUT_TIMER,
+};
+
+typedef struct {
+	PolicyRule rule;
+	gboolean   seeded;	/* evaluated once, holds is the real state */
+	gboolean   holds;	/* trigger true at the last evaluation */
+	gint64     deadline;	/* usec, monotonic for idle, wall clock for at; 0 for none */
+} RuleState;
+
+static RuleState rules[CONFIG_MAX_RULES];
+static guint n_rules = 0;
+
+static const RfkillDevice *table;
+static const guint *table_len;
+static PolicyApplyFunc apply_func;
+static gint8 pending[GRFKILL_MAX_DEVICES];	/* -1 keep, else blocked */
+
+static gint timer_fd = -1;
+static gint route_fd = -1;
+static gint uevent_fd = -1;
+static gint lid_fd = -1;
+static guint inputs_known = INPUT_RADIO | INPUT_TIMER;	/* reported their state */
+
+static gint links_up[MAX_UP_LINKS];	/* ifindex of wireless links that are up */
+static guint n_links_up = 0;
+static guint bt_connections = 0;
+static gboolean lid_closed = FALSE;
+
+/* what udevd puts in front of the properties, as libudev's monitor reads it */
+typedef struct {
+	gchar   prefix[8];		/* "libudev" */
+	guint32 magic;			/* UDEV_MONITOR_MAGIC, big endian */
+	guint32 header_size;
+	guint32 properties_off;
+	guint32 properties_len;
+	guint32 filter_subsystem_hash;	/* big endian */
+	guint32 filter_devtype_hash;
+	guint32 filter_tag_bloom_hi;
+	guint32 filter_tag_bloom_lo;
+} UdevHeader;
+
+static void evaluate (guint inputs);
+
+/* every radio of the type, or any for RFKILL_TYPE_ALL, and at least one */
+static gboolean
+radios_all (guint8 type, gboolean blocked)
+{
+	const RfkillDevice *dev;
+	gboolean any = FALSE;
+
+	for (dev = table; dev < table + *table_len; dev++) {
+		if (type != RFKILL_TYPE_ALL && dev->type != type)
+			continue;
+		if ((dev->soft || dev->hard) != blocked)
+			return FALSE;
+		any = TRUE;
+	}
+
+	return any;
+}
+
+static gboolean
+radio_on (guint8 type)
+{
+	const RfkillDevice *dev;
+
+	for (dev = table; dev < table + *table_len; dev++)
+		if (dev->type == type && !dev->soft && !dev->hard)
+			return TRUE;
+
+	return FALSE;
+}
+
+static gboolean
+trigger_holds (const PolicyRule *rule)
+{
+	switch (rule->trigger) {
+	case RULE_STATE:
+		return radios_all (rule->type, rule->blocked);
+	case RULE_CONNECTED:
+		return n_links_up > 0;
+	case RULE_IDLE:
+		return radio_on (rule->type) && bt_connections == 0;
+	case RULE_LID:
+		return lid_closed;
+	}
+
+	return FALSE;
+}
+
+/* wall clock usec of the next seconds-after-midnight, local time */
+static gint64
+next_at (guint32 seconds)
+{
+	GDateTime *now = g_date_time_new_now_local ();
+	GDateTime *day = g_date_time_ref (now);
+	GDateTime *at;
+	gint64 usec;
+
+	for (;;) {
+		at = g_date_time_new_local (g_date_time_get_year (day),
+					    g_date_time_get_month (day),
+					    g_date_time_get_day_of_month (day),
+					    seconds / 3600, seconds / 60 % 60, 0);
+		if (g_date_time_compare (at, now) > 0)
+			break;
+		g_date_time_unref (at);
+		at = g_date_time_add_days (day, 1);
+		g_date_time_unref (day);
+		day = at;
+	}
+
+	usec = g_date_time_to_unix (at) * G_USEC_PER_SEC;
+	g_date_time_unref (at);
+	g_date_time_unref (day);
+	g_date_time_unref (now);
+
+	return usec;
+}
+
+static void
+fire (const PolicyRule *rule)
+{
+	const RfkillProfile *profile = NULL;
+	guint state;
+	guint i;
+
+	if (rule->action == RULE_PROFILE &&
+	    (profile = config_profile (rule->profile)) == NULL)
+		return;
+
+	for (i = 0; i < *table_len; i++) {
+		if (profile)
+			state = config_profile_state (profile, table[i].type);
+		else if (rule->action_type == RFKILL_TYPE_ALL ||
+			 rule->action_type == table[i].type)
+			state = rule->action == RULE_BLOCK ? PROFILE_BLOCK : PROFILE_UNBLOCK;
+		else
+			state = PROFILE_KEEP;
+
+		if (state != PROFILE_KEEP)
+			pending[i] = state == PROFILE_BLOCK;
+	}
+}
+
+/* hand over what the pass changed, in one go */
+static void
+flush (void)
+{
+	PolicyWrite writes[GRFKILL_MAX_DEVICES];
+	guint n_writes = 0;
+	guint i;
+
+	for (i = 0; i < *table_len; i++) {
+		if (pending[i] < 0 || table[i].soft == pending[i])
+			continue;
+		writes[n_writes].idx = table[i].idx;
+		writes[n_writes].blocked = pending[i];
+		n_writes++;
+	}
+	memset (pending, -1, sizeof (pending));
+
+	if (n_writes > 0)
+		apply_func (writes, n_writes);
+}
+
+/* a zero it_value disarms, so no deadline means no wakeup at all */
+static void
+arm_timer (void)
+{
+	struct itimerspec spec = { { 0 } };
+	gint64 real_now = g_get_real_time ();
+	gint64 mono_now = g_get_monotonic_time ();
+	gint64 earliest = 0;
+	gint64 when;
+	RuleState *r;
+
+	for (r = rules; r < rules + n_rules; r++) {
+		if (r->deadline == 0)
+			continue;
+		when = r->rule.trigger == RULE_IDLE ?
+			real_now + (r->deadline - mono_now) : r->deadline;
+		if (earliest == 0 || when < earliest)
+			earliest = when;
+	}
+
+	if (timer_fd < 0)
+		return;
+
+	spec.it_value.tv_sec = earliest / G_USEC_PER_SEC;
+	spec.it_value.tv_nsec = earliest % G_USEC_PER_SEC * 1000;
+	timerfd_settime (timer_fd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec, NULL);
+}
+
+static void
+evaluate (guint inputs)
+{
+	gint64 now = g_get_monotonic_time ();
+	gboolean holds;
+	guint needs;
+	RuleState *r;
+
+	for (r = rules; r < rules + n_rules; r++) {
+		needs = trigger_inputs[r->rule.trigger];
+		if (!(needs & inputs) || (needs & inputs_known) != needs)
+			continue;
+
+		holds = trigger_holds (&r->rule);
+		if (!r->seeded) {
+			/*
+			 * Already true when the rule appeared, at startup or on
+			 * reload: that is no change, so only idle starts counting.
+			 */
+			r->seeded = TRUE;
+			if (r->rule.trigger != RULE_IDLE) {
+				r->holds = holds;
+				continue;
+			}
+		}
+
+		if (r->rule.trigger == RULE_IDLE) {
+			/* fires from the timer, once per idle stretch */
+			if (holds && !r->holds)
+				r->deadline = now + (gint64) r->rule.seconds * G_USEC_PER_SEC;
+			else if (!holds)
+				r->deadline = 0;
+		} else if (holds && !r->holds) {
+			fire (&r->rule);
+		}
+		r->holds = holds;
+	}
+
+	flush ();
+	arm_timer ();
+}
+
+static gboolean
+timer_cb (gint         fd,
+	  GIOCondition condition,
+	  gpointer     data)
+{
+	gint64 real_now = g_get_real_time ();
+	gint64 mono_now = g_get_monotonic_time ();
+	guint64 expirations;
+	RuleState *r;
+
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_POLICY);
+
+	/*
+	 * ECANCELED: the clock was set. Deadlines it jumped past fire below;
+	 * after a jump back they are more than a day out and start over.
+	 */
+	if (read (fd, &expirations, sizeof (expirations)) < 0 && errno == ECANCELED)
+		for (r = rules; r < rules + n_rules; r++)
+			if (r->rule.trigger == RULE_AT &&
+			    r->deadline - real_now > (gint64) 24 * 3600 * G_USEC_PER_SEC)
+				r->deadline = next_at (r->rule.seconds);
+
+	for (r = rules; r < rules + n_rules; r++) {
+		if (r->deadline == 0)
+			continue;
+		if (r->rule.trigger == RULE_IDLE && r->deadline <= mono_now) {
+			fire (&r->rule);
+			r->deadline = 0;
+		} else if (r->rule.trigger == RULE_AT && r->deadline <= real_now) {
+			fire (&r->rule);
+			r->deadline = next_at (r->rule.seconds);
+		}
+	}
+
+	flush ();
+	arm_timer ();
+
+	return G_SOURCE_CONTINUE;
+}
+
+static void
+open_timer (void)
+{
+	timer_fd = timerfd_create (CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (timer_fd < 0) {
+		g_warning ("No timed rules: %s", g_strerror (errno));
+		return;
+	}
+
+	g_unix_fd_add (timer_fd, G_IO_IN, timer_cb, NULL);
+}
+
+static gboolean
+is_wireless (const gchar *ifname)
+{
+	gchar *path = g_build_filename ("/sys/class/net", ifname, "wireless", NULL);
+	gboolean wireless = g_file_test (path, G_FILE_TEST_EXISTS);
+
+	g_free (path);
+	return wireless;
+}
+
+/* TRUE if the set of wireless links that are up changed */
+static gboolean
+link_changed (gint ifindex, const gchar *ifname, gboolean up)
+{
+	guint i;
+
+	for (i = 0; i < n_links_up; i++)
+		if (links_up[i] == ifindex)
+			break;
+
+	if (up && i == n_links_up && n_links_up < MAX_UP_LINKS &&
+	    ifname && is_wireless (ifname)) {
+		links_up[n_links_up++] = ifindex;
+		return TRUE;
+	}
+	if (!up && i < n_links_up) {
+		links_up[i] = links_up[--n_links_up];
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+/* the replies come in through route_cb like any other link message */
+static void
+request_links (void)
+{
+	struct {
+		struct nlmsghdr  nh;
+		struct ifinfomsg ifi;
+	} req = { { 0 } };
+
+	req.nh.nlmsg_len = sizeof (req);
+	req.nh.nlmsg_type = RTM_GETLINK;
+	req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+	req.ifi.ifi_family = AF_UNSPEC;
+
+	send (route_fd, &req, sizeof (req), 0);
+}
+
+static gboolean
+route_cb (gint         fd,
+	  GIOCondition condition,
+	  gpointer     data)
+{
+	gchar buf[8192] __attribute__ ((aligned (NLMSG_ALIGNTO)));
+	struct nlmsghdr *nh;
+	struct ifinfomsg *ifi;
+	struct rtattr *rta;
+	const gchar *ifname;
+	guint8 operstate;
+	gboolean changed = FALSE;
+	gssize len;
+	gint attrlen;
+
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_POLICY);
+
+	while ((len = recv (fd, buf, sizeof (buf), 0)) > 0) {
+		for (nh = (struct nlmsghdr *) buf; NLMSG_OK (nh, len); nh = NLMSG_NEXT (nh, len)) {
+			/* end of request_links' dump, the link rules can start */
+			if (nh->nlmsg_type == NLMSG_DONE && !(inputs_known & INPUT_LINK)) {
+				inputs_known |= INPUT_LINK;
+				changed = TRUE;
+			}
+			if (nh->nlmsg_type != RTM_NEWLINK && nh->nlmsg_type != RTM_DELLINK)
+				continue;
+
+			ifi = NLMSG_DATA (nh);
+			ifname = NULL;
+			operstate = IF_OPER_UNKNOWN;
+			attrlen = IFLA_PAYLOAD (nh);
+			for (rta = IFLA_RTA (ifi); RTA_OK (rta, attrlen); rta = RTA_NEXT (rta, attrlen)) {
+				if (rta->rta_type == IFLA_IFNAME)
+					ifname = RTA_DATA (rta);
+				else if (rta->rta_type == IFLA_OPERSTATE)
+					operstate = *(guint8 *) RTA_DATA (rta);
+			}
+
+			changed |= link_changed (ifi->ifi_index, ifname,
+						 nh->nlmsg_type == RTM_NEWLINK &&
+						 operstate == IF_OPER_UP);
+		}
+	}
+
+	/*
+	 * The socket overflowed and messages are lost: ask for all of it
+	 * again and, as at startup, hold the link rules until its NLMSG_DONE.
+	 * A link that stayed up must not look like it went down and back.
+	 */
+	if (len < 0 && errno == ENOBUFS) {
+		n_links_up = 0;
+		inputs_known &= ~INPUT_LINK;
+		request_links ();
+	}
+
+	if (changed)
+		evaluate (INPUT_LINK);
+
+	return G_SOURCE_CONTINUE;
+}
+
+static void
+open_route (void)
+{
+	struct sockaddr_nl addr = { .nl_family = AF_NETLINK, .nl_groups = RTMGRP_LINK };
+
+	route_fd = socket (AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+	if (route_fd < 0 || bind (route_fd, (struct sockaddr *) &addr, sizeof (addr)) < 0) {
+		g_warning ("No link state for rules: %s", g_strerror (errno));
+		if (route_fd >= 0)
+			close (route_fd);
+		route_fd = -1;
+		inputs_known |= INPUT_LINK;	/* never changes, as far as we know */
+		return;
+	}
+
+	request_links ();
+	g_unix_fd_add (route_fd, G_IO_IN, route_cb, NULL);
+}
+
+/* hci0:256 and the like, one per ACL link */
+static gboolean
+is_connection (const gchar *name)
+{
+	return g_str_has_prefix (name, "hci") && strchr (name, ':') != NULL;
+}
+
+static gboolean
+uevent_cb (gint         fd,
+	   GIOCondition condition,
+	   gpointer     data)
+{
+	gchar buf[8192] __attribute__ ((aligned (8)));
+	gchar control[CMSG_SPACE (sizeof (struct ucred))];
+	const UdevHeader *header = (const UdevHeader *) buf;
+	struct iovec iov = { buf, sizeof (buf) - 1 };
+	struct msghdr msg = { .msg_iov = &iov, .msg_iovlen = 1 };
+	struct cmsghdr *cmsg;
+	const gchar *action;
+	const gchar *devpath;
+	const gchar *name;
+	const gchar *end;
+	gboolean bluetooth;
+	gboolean changed = FALSE;
+	gchar *p;
+	gssize len;
+
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_POLICY);
+
+	for (;;) {
+		msg.msg_control = control;
+		msg.msg_controllen = sizeof (control);
+		if ((len = recvmsg (fd, &msg, 0)) <= 0)
+			break;
+		buf[len] = '\0';
+
+		/* only udevd, running as root, speaks for devices */
+		cmsg = CMSG_FIRSTHDR (&msg);
+		if (cmsg == NULL || cmsg->cmsg_type != SCM_CREDENTIALS ||
+		    ((struct ucred *) CMSG_DATA (cmsg))->uid != 0)
+			continue;
+		if ((gsize) len < sizeof (UdevHeader) ||
+		    strcmp (header->prefix, "libudev") != 0 ||
+		    header->properties_off < sizeof (UdevHeader) ||
+		    header->properties_off + header->properties_len > (gsize) len)
+			continue;
+
+		action = NULL;
+		devpath = NULL;
+		bluetooth = FALSE;
+		/* KEY=value strings; the filter only let the hash through */
+		end = buf + header->properties_off + header->properties_len;
+		for (p = buf + header->properties_off; p < end; p += strlen (p) + 1) {
+			if (g_str_has_prefix (p, "ACTION="))
+				action = p + strlen ("ACTION=");
+			else if (g_str_has_prefix (p, "DEVPATH="))
+				devpath = p + strlen ("DEVPATH=");
+			else if (strcmp (p, "SUBSYSTEM=bluetooth") == 0)
+				bluetooth = TRUE;
+		}
+		if (!bluetooth || action == NULL || devpath == NULL)
+			continue;
+
+		name = strrchr (devpath, '/');
+		if (!is_connection (name ? name + 1 : devpath))
+			continue;
+
+		if (strcmp (action, "add") == 0) {
+			bt_connections++;
+			changed = TRUE;
+		} else if (strcmp (action, "remove") == 0 && bt_connections > 0) {
+			bt_connections--;
+			changed = TRUE;
+		}
+	}
+
+	if (changed)
+		evaluate (INPUT_BT);
+
+	return G_SOURCE_CONTINUE;
+}
+
+/* MurmurHash2 with seed 0, which udevd stores for the subsystem */
+static guint32
+subsystem_hash (const gchar *subsystem)
+{
+	const guint32 m = 0x5bd1e995;
+	const guchar *data = (const guchar *) subsystem;
+	gsize len = strlen (subsystem);
+	guint32 h = len;
+	guint32 k;
+
+	for (; len >= 4; data += 4, len -= 4) {
+		memcpy (&k, data, 4);
+		k *= m;
+		k ^= k >> 24;
+		k *= m;
+		h *= m;
+		h ^= k;
+	}
+
+	switch (len) {
+	case 3:
+		h ^= data[2] << 16;
+		/* fall through */
+	case 2:
+		h ^= data[1] << 8;
+		/* fall through */
+	case 1:
+		h ^= data[0];
+		h *= m;
+	}
+
+	h ^= h >> 13;
+	h *= m;
+	h ^= h >> 15;
+
+	return h;
+}
+
+/* drop everything but udevd's bluetooth events in the kernel */
+static gboolean
+attach_bluetooth_filter (gint fd)
+{
+	struct sock_filter code[] = {
+		BPF_STMT (BPF_LD | BPF_W | BPF_ABS, G_STRUCT_OFFSET (UdevHeader, magic)),
+		BPF_JUMP (BPF_JMP | BPF_JEQ | BPF_K, UDEV_MONITOR_MAGIC, 0, 3),
+		BPF_STMT (BPF_LD | BPF_W | BPF_ABS, G_STRUCT_OFFSET (UdevHeader, filter_subsystem_hash)),
+		BPF_JUMP (BPF_JMP | BPF_JEQ | BPF_K, subsystem_hash ("bluetooth"), 0, 1),
+		BPF_STMT (BPF_RET | BPF_K, 0xffffffff),
+		BPF_STMT (BPF_RET | BPF_K, 0),
+	};
+	struct sock_fprog prog = { G_N_ELEMENTS (code), code };
+
+	return setsockopt (fd, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof (prog)) == 0;
+}
+
+/*
+ * Bluetooth connections come from udevd rather than straight from the
+ * kernel: its messages carry the subsystem hash the filter checks, and
+ * the device is fully set up by the time they arrive.
+ */
+static void
+open_uevent (void)
+{
+	struct sockaddr_nl addr = { .nl_family = AF_NETLINK, .nl_groups = UDEV_MONITOR_GROUP };
+	const gchar *name;
+	gint on = 1;
+	GDir *dir;
+
+	uevent_fd = socket (AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC,
+			    NETLINK_KOBJECT_UEVENT);
+	if (uevent_fd < 0 || !attach_bluetooth_filter (uevent_fd) ||
+	    setsockopt (uevent_fd, SOL_SOCKET, SO_PASSCRED, &on, sizeof (on)) < 0 ||
+	    bind (uevent_fd, (struct sockaddr *) &addr, sizeof (addr)) < 0) {
+		g_warning ("No Bluetooth connections for rules: %s", g_strerror (errno));
+		if (uevent_fd >= 0)
+			close (uevent_fd);
+		uevent_fd = -1;
+		inputs_known |= INPUT_BT;
+		return;
+	}
+
+	/* bound first, so a connection made meanwhile is counted once */
+	dir = g_dir_open ("/sys/class/bluetooth", 0, NULL);
+	while (dir && (name = g_dir_read_name (dir)))
+		if (is_connection (name))
+			bt_connections++;
+	if (dir)
+		g_dir_close (dir);
+	inputs_known |= INPUT_BT;
+
+	g_unix_fd_add (uevent_fd, G_IO_IN, uevent_cb, NULL);
+}
+
+static gboolean
+read_lid (gint fd)
+{
+	gulong bits[SW_MAX / BITS_PER_LONG + 1] = { 0 };
+
+	ioctl (fd, EVIOCGSW (sizeof (bits)), bits);
+	return (bits[SW_LID / BITS_PER_LONG] >> (SW_LID % BITS_PER_LONG)) & 1;
+}
+
+static gboolean
+lid_cb (gint         fd,
+	GIOCondition condition,
+	gpointer     data)
+{
+	struct input_event ev;
+	gboolean closed = lid_closed;
+
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_POLICY);
+
+	while (read (fd, &ev, sizeof (ev)) == sizeof (ev)) {
+		if (ev.type == EV_SW && ev.code == SW_LID)
+			closed = ev.value != 0;
+		else if (ev.type == EV_SYN && ev.code == SYN_DROPPED)
+			closed = read_lid (fd);
+	}
+
+	if (closed != lid_closed) {
+		lid_closed = closed;
+		evaluate (INPUT_LID);
+	}
+
+	return G_SOURCE_CONTINUE;
+}
+
+/* the first event node with a lid switch; usually needs the input group */
+static void
+open_lid (void)
+{
+	gulong bits[SW_MAX / BITS_PER_LONG + 1];
+	const gchar *name;
+	gboolean denied = FALSE;
+	gchar *path;
+	GDir *dir;
+	gint fd;
+
+	dir = g_dir_open ("/dev/input", 0, NULL);
+	while (dir && lid_fd < 0 && (name = g_dir_read_name (dir))) {
+		if (!g_str_has_prefix (name, "event"))
+			continue;
+
+		path = g_build_filename ("/dev/input", name, NULL);
+		fd = open (path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+		g_free (path);
+		if (fd < 0) {
+			denied = denied || errno == EACCES;
+			continue;
+		}
+
+		memset (bits, 0, sizeof (bits));
+		if (ioctl (fd, EVIOCGBIT (EV_SW, sizeof (bits)), bits) >= 0 &&
+		    (bits[SW_LID / BITS_PER_LONG] >> (SW_LID % BITS_PER_LONG)) & 1)
+			lid_fd = fd;
+		else
+			close (fd);
+	}
+	if (dir)
+		g_dir_close (dir);
+
+	inputs_known |= INPUT_LID;
+	if (lid_fd < 0) {
+		g_warning ("No lid switch for rules%s", denied ?
+			   ": cannot read /dev/input, join the input group" : "");
+		return;
+	}
+
+	lid_closed = read_lid (lid_fd);
+	g_unix_fd_add (lid_fd, G_IO_IN, lid_cb, NULL);
+}
+
+/* resident only; rules are loaded separately and again on every edit */
+void
+policy_start (const RfkillDevice *devices,
+	      const guint        *n_devices,
+	      PolicyApplyFunc     apply)
+{
+	table = devices;
+	table_len = n_devices;
+	apply_func = apply;
+	memset (pending, -1, sizeof (pending));
+}
+
+void
+policy_load (const GrfkillConfig *config)
+{
+	RuleState fresh[CONFIG_MAX_RULES];
+	guint needs = 0;
+	guint i, j;
+
+	for (i = 0; i < config->n_rules; i++) {
+		fresh[i].rule = config->rules[i];
+		fresh[i].seeded = FALSE;
+		fresh[i].holds = FALSE;
+		fresh[i].deadline = config->rules[i].trigger == RULE_AT ?
+			next_at (config->rules[i].seconds) : 0;
+
+		/* a rule that was kept does not fire again for an edit elsewhere */
+		for (j = 0; j < n_rules; j++) {
+			if (memcmp (&rules[j].rule, &fresh[i].rule, sizeof (PolicyRule)) == 0) {
+				fresh[i].seeded = rules[j].seeded;
+				fresh[i].holds = rules[j].holds;
+				fresh[i].deadline = rules[j].deadline;
+				break;
+			}
+		}
+
+		needs |= trigger_inputs[fresh[i].rule.trigger];
+	}
+
+	memcpy (rules, fresh, config->n_rules * sizeof (RuleState));
+	n_rules = config->n_rules;
+
+	if ((needs & INPUT_TIMER) && timer_fd < 0)
+		open_timer ();
+	if ((needs & INPUT_LINK) && route_fd < 0)
+		open_route ();
+	if ((needs & INPUT_BT) && uevent_fd < 0)
+		open_uevent ();
+	if ((needs & INPUT_LID) && lid_fd < 0)
+		open_lid ();
+
+	evaluate (INPUT_ALL);
+}
+
+/* a radio was added, removed or changed state */
+void
+policy_radio_changed (void)
+{
+	if (n_rules > 0)
+		evaluate (INPUT_RADIO);
+}
@@ -0,0 +1,411 @@
+/**
+ * Session bus service exposing the radios of a resident grfkill.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * org.grfkill.Rfkill at /org/grfkill/Rfkill has SetBlocked(index,
+ * blocked), SetAllBlocked(type, blocked), ApplyProfile(name) for a
+ * [Profile name] of the config file and a Devices property listing
+ * one object per device. Each device object carries Index, Type, Name,
+ * SoftBlocked and HardBlocked, and emits PropertiesChanged when a
+ * /dev/rfkill event changes them.
+ *
+ * A write the kernel refused is the method's error: AccessDenied for
+ * EPERM and EACCES, Failed otherwise, including unblocking a radio that
+ * is hard blocked. Methods that write several radios return the first.
+ */
+
+#include <gio/gio.h>
+#include <errno.h>
+#include <string.h>
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+
+#define DBUS_NAME         "org.grfkill.Rfkill"
+#define DBUS_PATH         "/org/grfkill/Rfkill"
+#define DBUS_IFACE        "org.grfkill.Rfkill"
+#define DBUS_DEVICE_IFACE "org.grfkill.Rfkill.Device"
+
+static const gchar introspection_xml[] =
+	"<node>"
+	"  <interface name='" DBUS_IFACE "'>"
+	"    <method name='SetBlocked'>"
+	"      <arg type='u' name='index' direction='in'/>"
+	"      <arg type='b' name='blocked' direction='in'/>"
+	"    </method>"
+	"    <method name='SetAllBlocked'>"
+	"      <arg type='s' name='type' direction='in'/>"
+	"      <arg type='b' name='blocked' direction='in'/>"
+	"    </method>"
+	"    <method name='ApplyProfile'>"
+	"      <arg type='s' name='name' direction='in'/>"
+	"    </method>"
+	"    <property name='Devices' type='ao' access='read'/>"
+	"  </interface>"
+	"  <interface name='" DBUS_DEVICE_IFACE "'>"
+	"    <method name='SetBlocked'>"
+	"      <arg type='b' name='blocked' direction='in'/>"
+	"    </method>"
+	"    <property name='Index' type='u' access='read'/>"
+	"    <property name='Type' type='s' access='read'/>"
+	"    <property name='Name' type='s' access='read'/>"
+	"    <property name='SoftBlocked' type='b' access='read'/>"
+	"    <property name='HardBlocked' type='b' access='read'/>"
+	"  </interface>"
+	"</node>";
+
+static GDBusNodeInfo *introspection = NULL;
+static GDBusConnection *connection = NULL;
+
+static const RfkillDevice *table;
+static const guint *table_len;
+static RfkillSetBlockFunc set_block;
+
+/* registration ids of the per-device objects */
+static guint device_regs[GRFKILL_MAX_DEVICES];
+static guint n_device_regs = 0;
+
+static void
+device_path (guint32 idx, gchar *path, gsize len)
+{
+	g_snprintf (path, len, DBUS_PATH "/rfkill%u", idx);
+}
+
+static const RfkillDevice *
+lookup (guint32 idx)
+{
+	guint i;
+
+	for (i = 0; i < *table_len; i++)
+		if (table[i].idx == idx)
+			return &table[i];
+
+	return NULL;
+}
+
+/* a failed write as the method's error, FALSE if there was none */
+static gboolean
+return_write_error (GDBusMethodInvocation *invocation, guint32 idx, gint err)
+{
+	switch (err) {
+	case 0:
+		return FALSE;
+	case -EPERM:
+	case -EACCES:
+		g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR,
+						       G_DBUS_ERROR_ACCESS_DENIED,
+						       "rfkill%u: %s", idx, g_strerror (-err));
+		break;
+	case -ERFKILL:
+		g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR,
+						       G_DBUS_ERROR_FAILED,
+						       "rfkill%u is hard blocked", idx);
+		break;
+	default:
+		g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR,
+						       G_DBUS_ERROR_FAILED,
+						       "rfkill%u: %s", idx, g_strerror (-err));
+		break;
+	}
+
+	return TRUE;
+}
+
+static void
+manager_method_call (GDBusConnection       *conn,
+		     const gchar           *sender,
+		     const gchar           *object_path,
+		     const gchar           *interface_name,
+		     const gchar           *method_name,
+		     GVariant              *parameters,
+		     GDBusMethodInvocation *invocation,
+		     gpointer               user_data)
+{
+	const RfkillProfile *profile;
+	const gchar *type_name;
+	const gchar *name;
+	gboolean blocked;
+	guint32 idx;
+	guint32 failed = 0;
+	guint type;
+	guint i;
+	gint err = 0;
+	gint ret;
+
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_DBUS);
+
+	if (g_strcmp0 (method_name, "SetBlocked") == 0) {
+		g_variant_get (parameters, "(ub)", &idx, &blocked);
+		err = set_block (idx, blocked);
+		if (err == -ENODEV) {
+			g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR,
+							       G_DBUS_ERROR_INVALID_ARGS,
+							       "no rfkill device %u", idx);
+			return;
+		}
+		failed = idx;
+	} else if (g_strcmp0 (method_name, "SetAllBlocked") == 0) {
+		g_variant_get (parameters, "(&sb)", &type_name, &blocked);
+		type = *type_name ? rfkill_type_from_name (type_name) : RFKILL_TYPE_ALL;
+		if (type >= NUM_RFKILL_TYPES) {
+			g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR,
+							       G_DBUS_ERROR_INVALID_ARGS,
+							       "unknown rfkill type \"%s\"", type_name);
+			return;
+		}
+		for (i = 0; i < *table_len; i++) {
+			if (type != RFKILL_TYPE_ALL && table[i].type != type)
+				continue;
+			ret = set_block (table[i].idx, blocked);
+			if (ret != 0 && err == 0) {
+				err = ret;
+				failed = table[i].idx;
+			}
+		}
+	} else if (g_strcmp0 (method_name, "ApplyProfile") == 0) {
+		g_variant_get (parameters, "(&s)", &name);
+		profile = config_profile (name);
+		if (profile == NULL) {
+			g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR,
+							       G_DBUS_ERROR_INVALID_ARGS,
+							       "no profile \"%s\"", name);
+			return;
+		}
+		for (i = 0; i < *table_len; i++) {
+			switch (config_profile_state (profile, table[i].type)) {
+			case PROFILE_BLOCK:
+				ret = set_block (table[i].idx, TRUE);
+				break;
+			case PROFILE_UNBLOCK:
+				ret = set_block (table[i].idx, FALSE);
+				break;
+			default:
+				continue;
+			}
+			if (ret != 0 && err == 0) {
+				err = ret;
+				failed = table[i].idx;
+			}
+		}
+	}
+
+	if (!return_write_error (invocation, failed, err))
+		g_dbus_method_invocation_return_value (invocation, NULL);
+}
+
+static GVariant *
+devices_variant (void)
+{
+	GVariantBuilder paths;
+	gchar path[64];
+	guint i;
+
+	g_variant_builder_init (&paths, G_VARIANT_TYPE ("ao"));
+	for (i = 0; i < *table_len; i++) {
+		device_path (table[i].idx, path, sizeof (path));
+		g_variant_builder_add (&paths, "o", path);
+	}
+
+	return g_variant_builder_end (&paths);
+}
+
+static GVariant *
+manager_get_property (GDBusConnection *conn,
+		      const gchar     *sender,
+		      const gchar     *object_path,
+		      const gchar     *interface_name,
+		      const gchar     *property_name,
+		      GError         **error,
+		      gpointer         user_data)
+{
+	return devices_variant ();
+}
+
+static void
+device_method_call (GDBusConnection       *conn,
+		    const gchar           *sender,
+		    const gchar           *object_path,
+		    const gchar           *interface_name,
+		    const gchar           *method_name,
+		    GVariant              *parameters,
+		    GDBusMethodInvocation *invocation,
+		    gpointer               user_data)
+{
+	guint32 idx = GPOINTER_TO_UINT (user_data);
+	gboolean blocked;
+	gint err;
+
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_DBUS);
+
+	g_variant_get (parameters, "(b)", &blocked);
+	err = set_block (idx, blocked);
+	if (err == -ENODEV) {
+		g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR,
+						       G_DBUS_ERROR_UNKNOWN_OBJECT,
+						       "rfkill device %u is gone", idx);
+		return;
+	}
+
+	if (!return_write_error (invocation, idx, err))
+		g_dbus_method_invocation_return_value (invocation, NULL);
+}
+
+static GVariant *
+device_get_property (GDBusConnection *conn,
+		     const gchar     *sender,
+		     const gchar     *object_path,
+		     const gchar     *interface_name,
+		     const gchar     *property_name,
+		     GError         **error,
+		     gpointer         user_data)
+{
+	const RfkillDevice *dev = lookup (GPOINTER_TO_UINT (user_data));
+
+	if (dev == NULL) {
+		g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_OBJECT,
+			     "rfkill device is gone");
+		return NULL;
+	}
+
+	if (g_strcmp0 (property_name, "Index") == 0)
+		return g_variant_new_uint32 (dev->idx);
+	if (g_strcmp0 (property_name, "Type") == 0)
+		return g_variant_new_string (rfkill_type_name (dev->type));
+	if (g_strcmp0 (property_name, "Name") == 0)
+		return g_variant_new_string (dev->name);
+	if (g_strcmp0 (property_name, "SoftBlocked") == 0)
+		return g_variant_new_boolean (dev->soft);
+	if (g_strcmp0 (property_name, "HardBlocked") == 0)
+		return g_variant_new_boolean (dev->hard);
+
+	g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_PROPERTY,
+		     "no property %s", property_name);
+	return NULL;
+}
+
+static const GDBusInterfaceVTable manager_vtable = {
+	manager_method_call,
+	manager_get_property,
+	NULL
+};
+
+static const GDBusInterfaceVTable device_vtable = {
+	device_method_call,
+	device_get_property,
+	NULL
+};
+
+static void
+emit_properties_changed (const gchar     *path,
+			 const gchar     *interface_name,
+			 GVariantBuilder *changed)
+{
+	const gchar *invalidated[] = { NULL };
+
+	g_dbus_connection_emit_signal (connection, NULL, path,
+				       "org.freedesktop.DBus.Properties",
+				       "PropertiesChanged",
+				       g_variant_new ("(sa{sv}^as)", interface_name,
+						      changed, invalidated),
+				       NULL);
+}
+
+static void
+register_devices (void)
+{
+	gchar path[64];
+	guint i;
+
+	for (i = 0; i < n_device_regs; i++)
+		g_dbus_connection_unregister_object (connection, device_regs[i]);
+	n_device_regs = 0;
+
+	for (i = 0; i < *table_len; i++) {
+		device_path (table[i].idx, path, sizeof (path));
+		device_regs[n_device_regs] =
+			g_dbus_connection_register_object (connection, path,
+							   introspection->interfaces[1],
+							   &device_vtable,
+							   GUINT_TO_POINTER (table[i].idx),
+							   NULL, NULL);
+		if (device_regs[n_device_regs])
+			n_device_regs++;
+	}
+}
+
+static void
+bus_acquired_cb (GDBusConnection *conn,
+		 const gchar     *name,
+		 gpointer         user_data)
+{
+	GError *err = NULL;
+
+	connection = conn;
+	if (!g_dbus_connection_register_object (conn, DBUS_PATH,
+						introspection->interfaces[0],
+						&manager_vtable, NULL, NULL, &err)) {
+		g_warning ("Failed to export %s: %s", DBUS_PATH, err->message);
+		g_error_free (err);
+		connection = NULL;
+		return;
+	}
+
+	register_devices ();
+}
+
+static void
+name_lost_cb (GDBusConnection *conn,
+	      const gchar     *name,
+	      gpointer         user_data)
+{
+	g_warning ("Could not own %s on the session bus", name);
+}
+
+void
+rfkill_dbus_start (const RfkillDevice *devices,
+		   const guint        *n_devices,
+		   RfkillSetBlockFunc  set_block_func)
+{
+	table = devices;
+	table_len = n_devices;
+	set_block = set_block_func;
+
+	introspection = g_dbus_node_info_new_for_xml (introspection_xml, NULL);
+	g_bus_own_name (G_BUS_TYPE_SESSION, DBUS_NAME, G_BUS_NAME_OWNER_FLAGS_NONE,
+			bus_acquired_cb, NULL, name_lost_cb, NULL, NULL);
+}
+
+void
+rfkill_dbus_device_changed (const RfkillDevice *dev)
+{
+	GVariantBuilder changed;
+	gchar path[64];
+
+	if (connection == NULL)
+		return;
+
+	g_variant_builder_init (&changed, G_VARIANT_TYPE_VARDICT);
+	g_variant_builder_add (&changed, "{sv}", "SoftBlocked",
+			       g_variant_new_boolean (dev->soft));
+	g_variant_builder_add (&changed, "{sv}", "HardBlocked",
+			       g_variant_new_boolean (dev->hard));
+
+	device_path (dev->idx, path, sizeof (path));
+	emit_properties_changed (path, DBUS_DEVICE_IFACE, &changed);
+}
+
+void
+rfkill_dbus_devices_changed (void)
+{
+	GVariantBuilder changed;
+
+	if (connection == NULL)
+		return;
+
+	register_devices ();
+
+	g_variant_builder_init (&changed, G_VARIANT_TYPE_VARDICT);
+	g_variant_builder_add (&changed, "{sv}", "Devices", devices_variant ());
+	emit_properties_changed (DBUS_PATH, DBUS_IFACE, &changed);
+}
@@ -0,0 +1,106 @@
+/**
+ * /dev/rfkill event watch.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * The kernel replays an RFKILL_OP_ADD for every existing device when the
+ * fd is opened, then reports adds, removals and state changes as they
+ * happen, so the device table never has to be polled.
+ *
+ * GRFKILL_RFKILL_DEV in the environment names another device node. The
+ * tests use a FIFO: opened read-write, it hands every write straight
+ * back as an event, the way the kernel confirms a change.
+ */
+
+#include <glib.h>
+#include <glib-unix.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+
+#define RFKILL_DEV "/dev/rfkill"
+
+static gint rfkill_fd = -1;
+static RfkillEventFunc event_func;
+static gpointer event_data;
+
+static gboolean
+rfkill_readable_cb (gint         fd,
+		    GIOCondition condition,
+		    gpointer     user_data)
+{
+	struct rfkill_event event;
+	gssize len;
+
+	rfkill_shm_wakeup (GRFKILL_WAKEUP_RFKILL);
+
+	while ((len = read (fd, &event, sizeof (event))) > 0) {
+		if (len < RFKILL_EVENT_SIZE_V1)
+			continue;
+		event_func (&event, event_data);
+	}
+
+	if (len == 0 || (errno != EAGAIN && errno != EINTR)) {
+		close (rfkill_fd);
+		rfkill_fd = -1;
+		return G_SOURCE_REMOVE;
+	}
+
+	return G_SOURCE_CONTINUE;
+}
+
+gboolean
+rfkill_event_watch (RfkillEventFunc func,
+		    gpointer        user_data)
+{
+	const gchar *dev = g_getenv ("GRFKILL_RFKILL_DEV");
+
+	if (dev == NULL || *dev == '\0')
+		dev = RFKILL_DEV;
+
+	rfkill_fd = open (dev, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+	if (rfkill_fd < 0)
+		rfkill_fd = open (dev, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+	if (rfkill_fd < 0)
+		return FALSE;
+
+	event_func = func;
+	event_data = user_data;
+	g_unix_fd_add (rfkill_fd, G_IO_IN, rfkill_readable_cb, NULL);
+
+	return TRUE;
+}
+
+/**
+ * rfkill_event_write:
+ * Soft block or unblock one device through /dev/rfkill. Returns 0, or a
+ * negative errno; -EBADF means the fd is missing or read-only and the
+ * caller has to find another way.
+ */
+gint
+rfkill_event_write (guint32  idx,
+		    gboolean blocked)
+{
+	struct rfkill_event event = { 0 };
+
+	if (rfkill_fd < 0)
+		return -EBADF;
+
+	event.idx = idx;
+	event.op = RFKILL_OP_CHANGE;
+	event.soft = blocked ? 1 : 0;
+
+	if (write (rfkill_fd, &event, sizeof (event)) < 0)
+		return -errno;
+
+	return 0;
+}
+
+gboolean
+rfkill_event_watching (void)
+{
+	return rfkill_fd >= 0;
+}
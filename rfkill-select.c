@@ -0,0 +1,155 @@
+/**
+ * Device selectors for the --wlan/--bluetooth options.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * A selector is one of
+ *   wlan, type:wlan       an rfkill type name ("all" matches every type)
+ *   2, index:2            an rfkill index
+ *   phy*, name:phy*       a glob on the device name
+ * Several selectors may be given per option, comma separated or by
+ * repeating the option. They are compiled once into an RfkillMatcher, so
+ * matching a device is a bit test on its numeric type plus, only when
+ * name globs were given, a glob on its cached name.
+ */
+
+#include <glib.h>
+#include <string.h>
+#include <linux/rfkill.h>
+
+#include "grfkill.h"
+
+static gboolean
+add_index (RfkillMatcher *matcher,
+	   const gchar   *value,
+	   GError       **error)
+{
+	guint64 idx;
+
+	if (!g_ascii_string_to_unsigned (value, 10, 0, G_MAXUINT32, &idx, error))
+		return FALSE;
+
+	if (matcher->n_indices == GRFKILL_MAX_SELECTORS) {
+		g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+			     "too many index selectors");
+		return FALSE;
+	}
+	matcher->indices[matcher->n_indices++] = idx;
+
+	return TRUE;
+}
+
+static gboolean
+add_type (RfkillMatcher *matcher,
+	  const gchar   *value,
+	  GError       **error)
+{
+	guint type = rfkill_type_from_name (value);
+
+	if (type >= NUM_RFKILL_TYPES) {
+		g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+			     "unknown rfkill type \"%s\"", value);
+		return FALSE;
+	}
+
+	if (type == RFKILL_TYPE_ALL)
+		matcher->type_mask |= (1u << NUM_RFKILL_TYPES) - 1;
+	else
+		matcher->type_mask |= 1u << type;
+
+	return TRUE;
+}
+
+static gboolean
+add_name (RfkillMatcher *matcher,
+	  const gchar   *value,
+	  GError       **error)
+{
+	if (matcher->n_names == GRFKILL_MAX_SELECTORS) {
+		g_set_error (error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE,
+			     "too many name selectors");
+		return FALSE;
+	}
+	matcher->names[matcher->n_names++] = g_pattern_spec_new (value);
+
+	return TRUE;
+}
+
+static gboolean
+compile_selector (RfkillMatcher *matcher,
+		  const gchar   *selector,
+		  GError       **error)
+{
+	if (*selector == '\0')
+		return TRUE;
+
+	if (g_str_has_prefix (selector, "type:"))
+		return add_type (matcher, selector + strlen ("type:"), error);
+	if (g_str_has_prefix (selector, "index:"))
+		return add_index (matcher, selector + strlen ("index:"), error);
+	if (g_str_has_prefix (selector, "name:"))
+		return add_name (matcher, selector + strlen ("name:"), error);
+
+	/* bare words: a type name, then a number, else a name glob */
+	if (rfkill_type_from_name (selector) < NUM_RFKILL_TYPES)
+		return add_type (matcher, selector, error);
+	if (g_ascii_isdigit (*selector))
+		return add_index (matcher, selector, error);
+
+	return add_name (matcher, selector, error);
+}
+
+gboolean
+rfkill_matcher_compile (RfkillMatcher *matcher,
+			gchar        **selectors,
+			GError       **error)
+{
+	gchar **parts;
+	gchar **part;
+	gboolean ok = TRUE;
+
+	rfkill_matcher_clear (matcher);
+
+	for (; ok && selectors && *selectors; selectors++) {
+		parts = g_strsplit (*selectors, ",", -1);
+		for (part = parts; ok && *part; part++)
+			ok = compile_selector (matcher, g_strstrip (*part), error);
+		g_strfreev (parts);
+	}
+
+	if (!ok)
+		rfkill_matcher_clear (matcher);
+
+	return ok;
+}
+
+void
+rfkill_matcher_clear (RfkillMatcher *matcher)
+{
+	guint i;
+
+	for (i = 0; i < matcher->n_names; i++)
+		g_pattern_spec_free (matcher->names[i]);
+
+	memset (matcher, 0, sizeof (RfkillMatcher));
+}
+
+gboolean
+rfkill_matcher_match (const RfkillMatcher *matcher,
+		      const RfkillDevice  *dev)
+{
+	guint i;
+
+	if (matcher->type_mask & (1u << dev->type))
+		return TRUE;
+
+	for (i = 0; i < matcher->n_indices; i++)
+		if (matcher->indices[i] == dev->idx)
+			return TRUE;
+
+	for (i = 0; i < matcher->n_names; i++)
+		if (g_pattern_match_string (matcher->names[i], dev->name))
+			return TRUE;
+
+	return FALSE;
+}
@@ -0,0 +1,164 @@
+/**
+ * Writer side of the grfkill state file, see grfkill-state.h.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * There is one writer per user: it holds an flock on the file for as
+ * long as it runs, and a file naming a live pid is never taken over.
+ */
+
+#include <glib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "grfkill.h"
+#include "grfkill-state.h"
+
+G_STATIC_ASSERT (GRFKILL_STATE_MAX_DEVICES >= GRFKILL_MAX_DEVICES);
+G_STATIC_ASSERT (GRFKILL_STATE_NAME_LEN == GRFKILL_NAME_LEN);
+
+G_STATIC_ASSERT (GRFKILL_N_WAKEUPS <= GRFKILL_STATE_MAX_WAKEUPS);
+
+static struct grfkill_state *state_map = NULL;
+static gchar state_path[4096];
+static gint state_fd = -1;		/* kept open for the lock */
+
+/* counted here until the state file is mapped, then in the file */
+static guint64 local_wakeups[GRFKILL_STATE_MAX_WAKEUPS];
+static guint64 *wakeups = local_wakeups;
+
+/* the pid of a live writer, read from the file as it is; 0 if none */
+static pid_t
+live_writer (gint fd)
+{
+	struct grfkill_state snapshot;
+	struct stat st;
+	void *map;
+	pid_t pid = 0;
+
+	if (fstat (fd, &st) < 0 || st.st_size != sizeof (struct grfkill_state))
+		return 0;
+
+	map = mmap (NULL, sizeof (struct grfkill_state), PROT_READ, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED)
+		return 0;
+	if (grfkill_state_snapshot (map, &snapshot) == 0 &&
+	    snapshot.pid != getpid () && grfkill_state_alive (&snapshot))
+		pid = snapshot.pid;
+	munmap (map, sizeof (struct grfkill_state));
+
+	return pid;
+}
+
+/**
+ * rfkill_shm_open:
+ * Map the state file for writing. Returns 0, -EBUSY while another
+ * resident grfkill owns the file, or another negative errno.
+ */
+gint
+rfkill_shm_open (void)
+{
+	gint fd;
+	void *map;
+
+	if (grfkill_state_path (state_path, sizeof (state_path)) < 0)
+		return -errno;
+
+	fd = open (state_path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (fd < 0)
+		return -errno;
+
+	/* the lock closes the race between two starting at once */
+	if (flock (fd, LOCK_EX | LOCK_NB) < 0 || live_writer (fd) != 0) {
+		close (fd);
+		return -EBUSY;
+	}
+
+	if (ftruncate (fd, sizeof (struct grfkill_state)) < 0) {
+		close (fd);
+		return -errno;
+	}
+
+	map = mmap (NULL, sizeof (struct grfkill_state),
+		    PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		close (fd);
+		return -errno;
+	}
+
+	state_fd = fd;
+	state_map = map;
+	memcpy (state_map->wakeups, local_wakeups, sizeof (local_wakeups));
+	wakeups = state_map->wakeups;
+
+	return 0;
+}
+
+void
+rfkill_shm_publish (const RfkillDevice *devices,
+		    guint               n_devices)
+{
+	struct grfkill_state_device *out;
+	guint32 seq;
+	guint i;
+
+	if (state_map == NULL)
+		return;
+
+	/* an odd sequence from a writer that died mid-update stays odd */
+	seq = __atomic_load_n (&state_map->seq, __ATOMIC_RELAXED) | 1;
+	__atomic_store_n (&state_map->seq, seq, __ATOMIC_RELAXED);
+	__atomic_thread_fence (__ATOMIC_RELEASE);
+
+	state_map->magic = GRFKILL_STATE_MAGIC;
+	state_map->version = GRFKILL_STATE_VERSION;
+	state_map->pid = getpid ();
+	state_map->updated_usec = g_get_monotonic_time ();
+	state_map->n_devices = MIN (n_devices, GRFKILL_STATE_MAX_DEVICES);
+
+	for (i = 0; i < state_map->n_devices; i++) {
+		out = &state_map->devices[i];
+		out->idx = devices[i].idx;
+		out->type = devices[i].type;
+		out->soft = devices[i].soft;
+		out->hard = devices[i].hard;
+		out->persistent = devices[i].persistent;
+		memcpy (out->name, devices[i].name, sizeof (out->name));
+	}
+
+	__atomic_store_n (&state_map->seq, seq + 1, __ATOMIC_RELEASE);
+}
+
+void
+rfkill_shm_wakeup (guint source)
+{
+	__atomic_fetch_add (&wakeups[source], 1, __ATOMIC_RELAXED);
+}
+
+void
+rfkill_shm_close (void)
+{
+	guint32 seq;
+
+	if (state_map == NULL)
+		return;
+
+	/* readers that still have it mapped see a clean exit, not a stale pid */
+	seq = __atomic_load_n (&state_map->seq, __ATOMIC_RELAXED) | 1;
+	__atomic_store_n (&state_map->seq, seq, __ATOMIC_RELAXED);
+	__atomic_thread_fence (__ATOMIC_RELEASE);
+	state_map->pid = 0;
+	__atomic_store_n (&state_map->seq, seq + 1, __ATOMIC_RELEASE);
+
+	wakeups = local_wakeups;
+	unlink (state_path);
+	munmap (state_map, sizeof (struct grfkill_state));
+	state_map = NULL;
+	close (state_fd);
+	state_fd = -1;
+}
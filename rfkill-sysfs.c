@@ -0,0 +1,264 @@
+/**
+ * sysfs scanner for /sys/class/rfkill.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * All attribute files are opened relative to the class directory fd and
+ * read in one batch (a single io_uring submission when built with
+ * liburing, plain preads otherwise) into a static arena, so a scan does
+ * not build path strings or allocate. GRFKILL_SYSFS in the environment
+ * points it at another class directory, e.g. the tests' fake one.
+ */
+
+#define _GNU_SOURCE
+
+#include <glib.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/rfkill.h>
+#ifdef HAVE_LIBURING
+#include <liburing.h>
+#endif
+
+#include "grfkill.h"
+
+#define RFKILL_SYSFS "/sys/class/rfkill"
+#define ATTR_LEN     GRFKILL_NAME_LEN
+
+enum {
+	ATTR_TYPE,
+	ATTR_NAME,
+	ATTR_SOFT,
+	ATTR_HARD,
+	ATTR_STATE,
+	ATTR_PERSISTENT,
+	N_ATTRS
+};
+
+static const gchar *const attr_files[N_ATTRS] = {
+	"type", "name", "soft", "hard", "state", "persistent"
+};
+
+#define N_SLOTS (GRFKILL_MAX_DEVICES * N_ATTRS)
+
+/* slot = device * N_ATTRS + attribute */
+static gchar arena[N_SLOTS][ATTR_LEN];
+static gint  slot_fd[N_SLOTS];
+static gint  slot_len[N_SLOTS];
+
+static const gchar *const type_names[NUM_RFKILL_TYPES] = {
+	[RFKILL_TYPE_ALL]       = "all",
+	[RFKILL_TYPE_WLAN]      = "wlan",
+	[RFKILL_TYPE_BLUETOOTH] = "bluetooth",
+	[RFKILL_TYPE_UWB]       = "ultrawideband",
+	[RFKILL_TYPE_WIMAX]     = "wimax",
+	[RFKILL_TYPE_WWAN]      = "wwan",
+	[RFKILL_TYPE_GPS]       = "gps",
+	[RFKILL_TYPE_FM]        = "fm",
+	[RFKILL_TYPE_NFC]       = "nfc",
+};
+
+const gchar *
+rfkill_type_name (guint type)
+{
+	if (type >= NUM_RFKILL_TYPES)
+		return "unknown";
+	return type_names[type];
+}
+
+guint
+rfkill_type_from_name (const gchar *name)
+{
+	guint type;
+
+	for (type = 0; type < NUM_RFKILL_TYPES; type++)
+		if (g_strcmp0 (name, type_names[type]) == 0)
+			return type;
+
+	return NUM_RFKILL_TYPES;
+}
+
+static const gchar *
+class_path (void)
+{
+	const gchar *path = g_getenv ("GRFKILL_SYSFS");
+
+	return path && *path ? path : RFKILL_SYSFS;
+}
+
+#ifdef HAVE_LIBURING
+static gboolean
+read_slots_uring (guint n_slots)
+{
+	static struct io_uring ring;
+	static gint ring_state = 0; /* 0 untried, 1 ready, -1 unavailable */
+	struct io_uring_sqe *sqe;
+	struct io_uring_cqe *cqe;
+	guint slot;
+	guint queued = 0;
+	guint i;
+
+	if (ring_state == 0)
+		ring_state = io_uring_queue_init (N_SLOTS, &ring, 0) == 0 ? 1 : -1;
+	if (ring_state < 0)
+		return FALSE;
+
+	for (slot = 0; slot < n_slots; slot++) {
+		if (slot_fd[slot] < 0)
+			continue;
+		sqe = io_uring_get_sqe (&ring);
+		io_uring_prep_read (sqe, slot_fd[slot], arena[slot], ATTR_LEN - 1, 0);
+		io_uring_sqe_set_data (sqe, GUINT_TO_POINTER (slot));
+		queued++;
+	}
+
+	if (queued == 0)
+		return TRUE;
+
+	if (io_uring_submit_and_wait (&ring, queued) < 0)
+		goto broken;
+
+	for (i = 0; i < queued; i++) {
+		if (io_uring_wait_cqe (&ring, &cqe) < 0)
+			goto broken;
+		slot = GPOINTER_TO_UINT (io_uring_cqe_get_data (cqe));
+		slot_len[slot] = cqe->res;
+		io_uring_cqe_seen (&ring, cqe);
+	}
+
+	return TRUE;
+
+broken:
+	/* don't reuse a ring with completions in an unknown state */
+	io_uring_queue_exit (&ring);
+	ring_state = -1;
+	return FALSE;
+}
+#endif
+
+static void
+read_slots_sync (guint n_slots)
+{
+	guint slot;
+
+	for (slot = 0; slot < n_slots; slot++)
+		if (slot_fd[slot] >= 0)
+			slot_len[slot] = pread (slot_fd[slot], arena[slot], ATTR_LEN - 1, 0);
+}
+
+/* terminate an attribute in place and strip the trailing newline */
+static const gchar *
+slot_str (guint slot)
+{
+	gint len = slot_len[slot];
+
+	if (slot_fd[slot] < 0 || len <= 0) {
+		arena[slot][0] = '\0';
+		return arena[slot];
+	}
+	if (arena[slot][len - 1] == '\n')
+		len--;
+	arena[slot][len] = '\0';
+
+	return arena[slot];
+}
+
+static guint8
+slot_uint (guint slot)
+{
+	return (guint8) strtoul (slot_str (slot), NULL, 10);
+}
+
+/*
+ * Insertion sort: readdir mostly hands the devices out in index order
+ * already, and unlike qsort it never allocates a merge buffer.
+ */
+static void
+sort_by_index (RfkillDevice *devices, guint n)
+{
+	RfkillDevice dev;
+	guint i;
+	guint j;
+
+	for (i = 1; i < n; i++) {
+		dev = devices[i];
+		for (j = i; j > 0 && devices[j - 1].idx > dev.idx; j--)
+			devices[j] = devices[j - 1];
+		devices[j] = dev;
+	}
+}
+
+/**
+ * rfkill_sysfs_scan:
+ * Fill @devices with every rfkill device, sorted by index. Returns the
+ * number of devices found, or -1 if the class directory is missing.
+ */
+gint
+rfkill_sysfs_scan (RfkillDevice *devices,
+		   guint         max_devices)
+{
+	static DIR *class_dir = NULL;
+	struct dirent *ent;
+	RfkillDevice *dev;
+	guint n = 0;
+	guint slot;
+	guint a;
+	gint dev_fd;
+
+	if (class_dir == NULL) {
+		class_dir = opendir (class_path ());
+		if (class_dir == NULL)
+			return -1;
+	} else {
+		rewinddir (class_dir);
+	}
+
+	max_devices = MIN (max_devices, GRFKILL_MAX_DEVICES);
+
+	while (n < max_devices && (ent = readdir (class_dir)) != NULL) {
+		/* rfkill folder is full of symlinks named rfkill<index> */
+		if (!g_str_has_prefix (ent->d_name, "rfkill"))
+			continue;
+
+		dev_fd = openat (dirfd (class_dir), ent->d_name,
+				 O_PATH | O_DIRECTORY | O_CLOEXEC);
+		if (dev_fd < 0)
+			continue;
+
+		devices[n].idx = strtoul (ent->d_name + strlen ("rfkill"), NULL, 10);
+		for (a = 0; a < N_ATTRS; a++) {
+			slot = n * N_ATTRS + a;
+			slot_fd[slot] = openat (dev_fd, attr_files[a], O_RDONLY | O_CLOEXEC);
+			slot_len[slot] = -1;
+		}
+		close (dev_fd);
+		n++;
+	}
+
+#ifdef HAVE_LIBURING
+	if (!read_slots_uring (n * N_ATTRS))
+#endif
+		read_slots_sync (n * N_ATTRS);
+
+	for (dev = devices; dev < devices + n; dev++) {
+		slot = (dev - devices) * N_ATTRS;
+
+		dev->type       = rfkill_type_from_name (slot_str (slot + ATTR_TYPE));
+		dev->soft       = slot_uint (slot + ATTR_SOFT);
+		dev->hard       = slot_uint (slot + ATTR_HARD);
+		dev->state      = slot_uint (slot + ATTR_STATE);
+		dev->persistent = slot_uint (slot + ATTR_PERSISTENT);
+		g_strlcpy (dev->name, slot_str (slot + ATTR_NAME), sizeof (dev->name));
+	}
+
+	for (slot = 0; slot < n * N_ATTRS; slot++)
+		if (slot_fd[slot] >= 0)
+			close (slot_fd[slot]);
+
+	sort_by_index (devices, n);
+
+	return n;
+}
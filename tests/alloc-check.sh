@@ -0,0 +1,20 @@
+#!/bin/sh
+# Once warmed up, a sysfs rescan and a switch toggle must not allocate:
+# grfkill --alloc-check counts through the preloaded tests/alloc-count.so.
+#
+# Same license as gtk-nodeco.c.
+
+. "$(dirname "$0")/lib.sh"
+
+SHIM=$(cd "$(dirname "$0")" && pwd)/alloc-count.so
+[ -f "$SHIM" ] || fail "build $SHIM first (make check does)"
+
+fake_rfkill wlan:phy0:0 bluetooth:hci0:1 wwan:modem0:0
+
+LD_PRELOAD="$SHIM" "$GRFKILL" --alloc-check 100 > "$TEST_DIR/out" 2>&1 || {
+	cat "$TEST_DIR/out" >&2
+	fail "the scan or toggle path allocated"
+}
+cat "$TEST_DIR/out"
+
+echo "PASS: $(basename "$0")"
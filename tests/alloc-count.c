@@ -0,0 +1,79 @@
+/**
+ * LD_PRELOAD shim counting heap allocations, for grfkill --alloc-check.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * Every allocating entry point is handed on to glibc's own and counted
+ * for the calling thread; alloc_count () returns that thread's total, so
+ * the audit flusher or GDBus threads don't blur the main loop's numbers.
+ * Freeing is not counted.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+extern void *__libc_malloc (size_t size);
+extern void *__libc_calloc (size_t n, size_t size);
+extern void *__libc_realloc (void *ptr, size_t size);
+extern void *__libc_memalign (size_t alignment, size_t size);
+
+/* initial-exec: a dynamic TLS lookup could itself call malloc */
+static __thread uint64_t count __attribute__ ((tls_model ("initial-exec")));
+
+uint64_t
+alloc_count (void)
+{
+	return count;
+}
+
+void *
+malloc (size_t size)
+{
+	count++;
+	return __libc_malloc (size);
+}
+
+void *
+calloc (size_t n, size_t size)
+{
+	count++;
+	return __libc_calloc (n, size);
+}
+
+void *
+realloc (void *ptr, size_t size)
+{
+	count++;
+	return __libc_realloc (ptr, size);
+}
+
+void *
+memalign (size_t alignment, size_t size)
+{
+	count++;
+	return __libc_memalign (alignment, size);
+}
+
+void *
+aligned_alloc (size_t alignment, size_t size)
+{
+	count++;
+	return __libc_memalign (alignment, size);
+}
+
+int
+posix_memalign (void **ptr, size_t alignment, size_t size)
+{
+	void *mem;
+
+	if (alignment < sizeof (void *) || (alignment & (alignment - 1)))
+		return EINVAL;
+
+	count++;
+	mem = __libc_memalign (alignment, size);
+	if (mem == NULL)
+		return ENOMEM;
+	*ptr = mem;
+	return 0;
+}
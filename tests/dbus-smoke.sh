@@ -0,0 +1,75 @@
+#!/bin/sh
+# The session bus service of a resident grfkill, on a private bus:
+# SetBlocked and SetAllBlocked change the fake radios, PropertiesChanged
+# reports it, Devices lists every device and unblocking a hard-blocked
+# radio is an error.
+#
+# Same license as gtk-nodeco.c.
+
+. "$(dirname "$0")/lib.sh"
+
+NAME=org.grfkill.Rfkill
+ROOT=/org/grfkill/Rfkill
+
+call ()
+{
+	gdbus call --session --dest $NAME --object-path "$@"
+}
+
+# soft IDX prints (<true>,) or (<false>,)
+soft ()
+{
+	call "$ROOT/rfkill$1" --method org.freedesktop.DBus.Properties.Get \
+		$NAME.Device SoftBlocked
+}
+
+# expect_change IDX true|false
+expect_change ()
+{
+	wait_for 5 "soft $1 | grep -q '<$2>'" ||
+		fail "rfkill$1 SoftBlocked is $(soft "$1"), wanted $2"
+	wait_for 5 "grep -qF \"rfkill$1: org.freedesktop.DBus.Properties.PropertiesChanged ('$NAME.Device', {'SoftBlocked': <$2>\" \"\$TEST_DIR/signals\"" ||
+		fail "no PropertiesChanged to $2 for rfkill$1"
+}
+
+fake_rfkill wlan:phy0:0 bluetooth:hci0:0 wwan:modem0:0 gps:gps0:1:1
+start_resident
+wait_for 10 "gdbus introspect --session --dest $NAME --object-path $ROOT" ||
+	fail "$NAME is not on the bus"
+
+gdbus monitor --session --dest $NAME > "$TEST_DIR/signals" &
+PIDS="$PIDS $!"
+wait_for 5 "grep -q 'is owned by' \"\$TEST_DIR/signals\"" ||
+	fail "gdbus monitor did not start"
+
+devices=$(call $ROOT --method org.freedesktop.DBus.Properties.Get $NAME Devices)
+for idx in 0 1 2 3; do
+	case "$devices" in
+	*"'$ROOT/rfkill$idx'"*) ;;
+	*) fail "Devices lacks rfkill$idx: $devices" ;;
+	esac
+done
+
+# first thing: the FIFO echoes every write back with hard cleared
+if call $ROOT --method $NAME.SetBlocked 3 false > "$TEST_DIR/hard" 2>&1; then
+	fail "SetBlocked unblocked a hard-blocked radio without an error"
+fi
+grep -q "hard blocked" "$TEST_DIR/hard" ||
+	fail "wrong error for a hard-blocked radio: $(cat "$TEST_DIR/hard")"
+
+call $ROOT --method $NAME.SetBlocked 0 true > /dev/null
+expect_change 0 true
+
+call $ROOT --method $NAME.SetAllBlocked '""' true > /dev/null
+expect_change 1 true
+expect_change 2 true
+
+call $ROOT --method $NAME.SetAllBlocked "'wlan'" false > /dev/null
+expect_change 0 false
+soft 1 | grep -q '<true>' || fail "SetAllBlocked wlan touched rfkill1"
+
+if call $ROOT --method $NAME.SetBlocked 7 true > /dev/null 2>&1; then
+	fail "SetBlocked accepted a missing device"
+fi
+
+echo "PASS: $(basename "$0")"
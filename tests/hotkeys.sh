@@ -0,0 +1,80 @@
+#!/bin/sh
+# Hotkeys grabbed by a resident grfkill, pressed with xdotool: XF86WLAN
+# and XF86Bluetooth flip the first radio of their class and nothing
+# else, a key without a radio behind it does nothing, and a bad binding
+# or one too many leaves no key grabbed at all.
+#
+# Same license as gtk-nodeco.c.
+
+. "$(dirname "$0")/lib.sh"
+
+command -v xdotool > /dev/null || fail "needs xdotool"
+
+# blocked IDX yes|no
+blocked ()
+{
+	"$GRFKILL_STATE" "$1" | grep -q "Soft blocked: $2"
+}
+
+expect ()
+{
+	wait_for 5 "blocked $1 $2" || fail "rfkill$1 soft blocked is not $2 $3"
+}
+
+# the same state for a second, i.e. no write happened
+expect_still ()
+{
+	sleep 1
+	blocked "$1" "$2" || fail "rfkill$1 changed $3"
+}
+
+stop_resident ()
+{
+	kill "$RESIDENT_PID"
+	wait "$RESIDENT_PID" || true
+}
+
+# bluetooth listed first: the wlan key must not fall back to index 0
+fake_rfkill bluetooth:hci0:0 wlan:phy0:0 wlan:phy1:0
+start_resident --hotkey wlan=XF86WLAN --hotkey bluetooth=XF86Bluetooth
+
+xdotool key XF86WLAN
+expect 1 yes "after XF86WLAN"
+expect_still 0 no "on XF86WLAN"
+blocked 2 no || fail "XF86WLAN flipped the second wlan device"
+
+xdotool key XF86Bluetooth
+expect 0 yes "after XF86Bluetooth"
+
+xdotool key XF86WLAN
+expect 1 no "after the second XF86WLAN"
+stop_resident
+
+# no wlan device at all: XF86WLAN has nothing to toggle
+rm -rf "$GRFKILL_SYSFS" "$GRFKILL_RFKILL_DEV"
+fake_rfkill bluetooth:hci0:0
+start_resident --hotkey wlan=XF86WLAN
+
+xdotool key XF86WLAN
+expect_still 0 no "on XF86WLAN without a wlan device"
+stop_resident
+
+# the bad second binding must not leave the first one grabbed
+start_resident --hotkey bluetooth=XF86Bluetooth --hotkey bogus=XF86WLAN
+
+xdotool key XF86Bluetooth
+expect_still 0 no "on XF86Bluetooth after a bad binding"
+stop_resident
+
+# HOTKEY_MAX is 16: a seventeenth binding fails the same way
+set --
+for i in $(seq 16); do
+	set -- "$@" --hotkey bluetooth=XF86Bluetooth
+done
+start_resident "$@" --hotkey wlan=XF86WLAN
+
+xdotool key XF86Bluetooth
+expect_still 0 no "on XF86Bluetooth with too many bindings"
+stop_resident
+
+echo "PASS: $(basename "$0")"
@@ -0,0 +1,56 @@
+#!/bin/sh
+# A resident grfkill that is left alone must not wake up at all: the
+# per-source wakeup counters may not move over an idle minute, with
+# policy rules loaded and deadlines armed. Any link change on the host
+# would wake the link rules, so those are in link-rules.sh instead, in
+# a network namespace of their own.
+#
+# Same license as gtk-nodeco.c.
+
+. "$(dirname "$0")/lib.sh"
+
+IDLE=${IDLE:-60}
+
+# half a day away, so the daily rule's timer is armed but never due
+AT=$(date -d '+12 hours' +%H:%M)
+
+mkdir -p "$XDG_CONFIG_HOME/grfkill"
+cat > "$XDG_CONFIG_HOME/grfkill/grfkill.conf" <<CONF
+[Rule modem off]
+when=wwan blocked
+do=block bluetooth
+
+[Rule bt idle]
+when=bluetooth idle 10m
+do=block bluetooth
+
+[Rule lid]
+when=lid closed
+do=block all
+
+[Rule daily]
+at=$AT
+do=unblock wlan
+CONF
+
+fake_rfkill wlan:phy0:0 bluetooth:hci0:0 wwan:modem0:1
+start_resident
+
+# the modem is off from the start, which is not a change to act on
+sleep 2
+"$GRFKILL_STATE" 1 | grep -q "Soft blocked: no" ||
+	fail "a rule fired for a trigger that was already true"
+
+# startup, the first frame and the D-Bus name are not idle time
+"$GRFKILL_STATE" --wakeups > "$TEST_DIR/before" ||
+	fail "grfkill-state --wakeups failed"
+
+sleep "$IDLE"
+"$GRFKILL_STATE" --wakeups > "$TEST_DIR/after"
+
+kill -0 "$RESIDENT_PID" 2>/dev/null || fail "grfkill --resident exited"
+if ! diff -u "$TEST_DIR/before" "$TEST_DIR/after" >&2; then
+	fail "woke up while idle for ${IDLE}s"
+fi
+
+echo "PASS: $(basename "$0")"
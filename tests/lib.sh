@@ -0,0 +1,105 @@
+# Shared setup for the tests, sourced by each of them.
+#
+# Same license as gtk-nodeco.c.
+#
+# Everything runs against a fake rfkill backend and private XDG
+# directories, so no real radio, state file or log is touched:
+#
+#	fake_rfkill TYPE:NAME:SOFT[:HARD] ...
+#
+# creates $GRFKILL_SYSFS with one rfkill<N> directory per argument and
+# $GRFKILL_RFKILL_DEV as a FIFO, which grfkill opens read-write and so
+# reads its own writes back as change events. The OSD needs a display
+# and the service a session bus; "make check" runs each test under
+# xvfb-run and dbus-run-session.
+
+set -eu
+
+GRFKILL=${GRFKILL:-./grfkill}
+GRFKILL_STATE=${GRFKILL_STATE:-./grfkill-state}
+RESIDENT_WRAPPER=""	# runs start_resident's grfkill, e.g. "unshare -rn"
+TEST_DIR=$(mktemp -d "${TMPDIR:-/tmp}/grfkill-test.XXXXXX")
+PIDS=""
+
+export XDG_RUNTIME_DIR="$TEST_DIR/run"
+export XDG_CONFIG_HOME="$TEST_DIR/config"
+export XDG_CACHE_HOME="$TEST_DIR/cache"
+export XDG_DATA_HOME="$TEST_DIR/data"
+mkdir -p "$XDG_RUNTIME_DIR" "$XDG_CONFIG_HOME" "$XDG_CACHE_HOME" "$XDG_DATA_HOME"
+chmod 700 "$XDG_RUNTIME_DIR"
+
+cleanup ()
+{
+	for pid in $PIDS; do
+		kill "$pid" 2>/dev/null || true
+		wait "$pid" 2>/dev/null || true
+	done
+	rm -rf "$TEST_DIR"
+}
+trap cleanup EXIT
+
+fail ()
+{
+	echo "FAIL: $(basename "$0"): $*" >&2
+	exit 1
+}
+
+# for what the machine running the tests cannot do; not a failure
+skip ()
+{
+	echo "SKIP: $(basename "$0"): $*"
+	exit 0
+}
+
+# wait_for SECONDS 'shell condition'
+wait_for ()
+{
+	tries=$(($1 * 10))
+	while ! eval "$2" >/dev/null 2>&1; do
+		tries=$((tries - 1))
+		[ "$tries" -gt 0 ] || return 1
+		sleep 0.1
+	done
+}
+
+fake_rfkill ()
+{
+	export GRFKILL_SYSFS="$TEST_DIR/sysfs"
+	export GRFKILL_RFKILL_DEV="$TEST_DIR/rfkill"
+	mkdir -p "$GRFKILL_SYSFS"
+
+	idx=0
+	for spec in "$@"; do
+		dir="$GRFKILL_SYSFS/rfkill$idx"
+		IFS=: read -r type name soft hard <<-SPEC
+		$spec
+		SPEC
+		hard=${hard:-0}
+		mkdir "$dir"
+		echo "$type" > "$dir/type"
+		echo "$name" > "$dir/name"
+		echo "$soft" > "$dir/soft"
+		echo "$hard" > "$dir/hard"
+		echo $(( soft || hard ? 0 : 1 )) > "$dir/state"
+		echo 0 > "$dir/persistent"
+		idx=$((idx + 1))
+	done
+
+	mkfifo "$GRFKILL_RFKILL_DEV"
+}
+
+# grfkill --resident in the background, returns once it published its state;
+# nothing is grabbed unless the arguments bind hotkeys
+start_resident ()
+{
+	case " $* " in
+	*" --hotkey "* | *" -k "*) ;;
+	*) set -- --hotkey none "$@" ;;
+	esac
+
+	$RESIDENT_WRAPPER "$GRFKILL" --resident "$@" &
+	RESIDENT_PID=$!
+	PIDS="$PIDS $RESIDENT_PID"
+	wait_for 10 'test -s "$XDG_RUNTIME_DIR/grfkill.state"' ||
+		fail "grfkill --resident did not start"
+}
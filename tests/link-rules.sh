@@ -0,0 +1,57 @@
+#!/bin/sh
+# Link state rules, with the resident in a network namespace of its own
+# so no link on the host can change under the test. The startup dump of
+# the route socket fires nothing, a link change wakes the policy without
+# firing a rule for a link that is not wireless, and after that an idle
+# minute with the rtnetlink subscription open has no wakeups.
+#
+# Same license as gtk-nodeco.c.
+
+. "$(dirname "$0")/lib.sh"
+
+IDLE=${IDLE:-60}
+
+unshare -rn true 2>/dev/null ||
+	skip "no unprivileged user and network namespaces"
+
+mkdir -p "$XDG_CONFIG_HOME/grfkill"
+cat > "$XDG_CONFIG_HOME/grfkill/grfkill.conf" <<CONF
+[Rule on wifi]
+when=wlan connected
+do=block wwan
+CONF
+
+# wakeups SOURCE prints how often SOURCE woke the resident
+wakeups ()
+{
+	"$GRFKILL_STATE" --wakeups | awk -v src="$1" '$1 == src { print $2 }'
+}
+
+fake_rfkill wlan:phy0:0 wwan:modem0:0
+RESIDENT_WRAPPER="unshare -rn"
+start_resident
+
+sleep 2
+"$GRFKILL_STATE" 1 | grep -q "Soft blocked: no" ||
+	fail "the link rule fired without a wireless link"
+
+before=$(wakeups policy)
+nsenter --preserve-credentials -U -n -t "$RESIDENT_PID" ip link set lo up ||
+	fail "cannot bring up lo in the resident's namespace"
+wait_for 5 '[ "$(wakeups policy)" -gt "$before" ]' ||
+	fail "the link change did not reach the policy"
+"$GRFKILL_STATE" 1 | grep -q "Soft blocked: no" ||
+	fail "lo coming up fired a wlan rule"
+
+"$GRFKILL_STATE" --wakeups > "$TEST_DIR/before" ||
+	fail "grfkill-state --wakeups failed"
+
+sleep "$IDLE"
+"$GRFKILL_STATE" --wakeups > "$TEST_DIR/after"
+
+kill -0 "$RESIDENT_PID" 2>/dev/null || fail "grfkill --resident exited"
+if ! diff -u "$TEST_DIR/before" "$TEST_DIR/after" >&2; then
+	fail "woke up while idle for ${IDLE}s"
+fi
+
+echo "PASS: $(basename "$0")"
@@ -0,0 +1,40 @@
+#!/bin/sh
+# The offscreen OSD against the golden images in tests/golden. Each is
+# named after what it shows, STATE@SCALEx.png with STATE the --state
+# argument spelt with _ for , and - for =, e.g. wlan-on_bt-off@1x.png.
+# The images are not committed yet, so "make check-golden" runs this
+# apart from "make check".
+#
+#	render-golden.sh           compare, failing on any difference
+#	render-golden.sh --update  redraw the goldens after a wanted change
+#
+# Same license as gtk-nodeco.c.
+
+. "$(dirname "$0")/lib.sh"
+
+GOLDEN_DIR=$(dirname "$0")/golden
+GOLDENS="wlan-on_bt-off@1x wlan-off_bt-on_wwan-on@1x wlan-on_bt-on@2x"
+
+for name in $GOLDENS; do
+	golden="$GOLDEN_DIR/$name.png"
+	state=$(echo "${name%@*}" | tr '_-' ',=')
+	scale=${name##*@}
+	scale=${scale%x}
+
+	if [ "${1:-}" = "--update" ]; then
+		"$GRFKILL" --render-png "$golden" --state "$state" --render-scale "$scale" ||
+			fail "cannot draw $golden"
+		echo "wrote $golden"
+		continue
+	fi
+
+	[ -f "$golden" ] || fail "$golden is missing, run make golden"
+	# the failing frame is kept next to the golden for a look
+	if ! "$GRFKILL" --render-compare "$golden" --render-png "$TEST_DIR/$name.png" \
+			--state "$state" --render-scale "$scale"; then
+		cp "$TEST_DIR/$name.png" "$GOLDEN_DIR/$name.actual.png"
+		fail "$name differs, see $GOLDEN_DIR/$name.actual.png"
+	fi
+done
+
+echo "PASS: $(basename "$0")"
@@ -0,0 +1,281 @@
+/**
+ * End-to-end toggle latency, per device type and stage.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * A toggle is followed from the switch's notify::active through the
+ * block/unblock write and the matching /dev/rfkill event to the next
+ * frame that repaints the icon:
+ *
+ *	issue   notify::active -> write issued
+ *	write   write issued   -> write returned
+ *	kernel  write returned -> rfkill event read
+ *	paint   rfkill event   -> frame drawn
+ *	total   notify::active -> frame drawn
+ *
+ * rfkill events carry no kernel timestamp, so "kernel" is measured with
+ * CLOCK_MONOTONIC when the event is read. A toggle made while the OSD is
+ * hidden ends at its event, without a paint stage. With the rfkill(8)
+ * fallback the write returns when the child is reaped, which can be after
+ * its event; such toggles end there and have no kernel stage. Toggles
+ * that never complete are dropped after PENDING_USEC. Samples go into
+ * HDR-style log-linear histograms: a power-of-two range split into 8
+ * linear sub-buckets, giving ~12% resolution from 1us to half an hour
+ * with fixed storage.
+ */
+
+#include <glib.h>
+#include <string.h>
+
+#include "grfkill.h"
+
+#define SUB_BITS	3
+#define SUB_COUNT	(1 << SUB_BITS)
+#define N_BUCKETS	((32 - SUB_BITS + 1) << SUB_BITS)
+#define N_PENDING	8
+#define PENDING_USEC	(10 * G_USEC_PER_SEC)
+
+enum {
+	STAGE_ISSUE,
+	STAGE_WRITE,
+	STAGE_KERNEL,
+	STAGE_PAINT,
+	STAGE_TOTAL,
+	N_STAGES
+};
+
+static const gchar *const stage_names[N_STAGES] = {
+	"issue", "write", "kernel", "paint", "total"
+};
+
+typedef struct {
+	guint32 counts[N_BUCKETS];
+	guint32 total;
+	guint64 max;
+} LatencyHist;
+
+typedef struct {
+	gboolean active;
+	guint32  idx;
+	guint8   type;
+	gint64   notify;
+	gint64   issued;
+	gint64   written;
+	gint64   event;
+} PendingToggle;
+
+static LatencyHist hists[NUM_RFKILL_TYPES][N_STAGES];
+static PendingToggle pending[N_PENDING];
+static guint incomplete = 0;
+
+static guint
+bucket_index (guint64 value)
+{
+	guint k;
+
+	if (value < SUB_COUNT)
+		return value;
+
+	k = g_bit_storage (value) - 1;
+	if (k > 31)
+		return N_BUCKETS - 1;
+
+	return ((k - SUB_BITS + 1) << SUB_BITS) + ((value >> (k - SUB_BITS)) & (SUB_COUNT - 1));
+}
+
+/* upper bound of a bucket, what percentiles report */
+static guint64
+bucket_value (guint index)
+{
+	guint k;
+
+	if (index < SUB_COUNT)
+		return index;
+
+	k = (index >> SUB_BITS) + SUB_BITS - 1;
+	return ((guint64) (SUB_COUNT + (index & (SUB_COUNT - 1)) + 1) << (k - SUB_BITS)) - 1;
+}
+
+static void
+hist_record (LatencyHist *hist, gint64 usec)
+{
+	guint64 value = MAX (usec, 0);
+
+	hist->counts[bucket_index (value)]++;
+	hist->total++;
+	hist->max = MAX (hist->max, value);
+}
+
+static guint64
+hist_percentile (const LatencyHist *hist, gdouble percentile)
+{
+	guint64 wanted = (guint64) (hist->total * percentile / 100.0 + 0.5);
+	guint64 seen = 0;
+	guint i;
+
+	for (i = 0; i < N_BUCKETS; i++) {
+		seen += hist->counts[i];
+		if (seen >= MAX (wanted, 1))
+			return MIN (bucket_value (i), hist->max);
+	}
+
+	return hist->max;
+}
+
+/* into the histograms; @painted is 0 if no frame showed the toggle */
+static void
+finish (PendingToggle *toggle, gint64 painted)
+{
+	LatencyHist *hist = hists[toggle->type];
+
+	hist_record (&hist[STAGE_ISSUE], toggle->issued - toggle->notify);
+	hist_record (&hist[STAGE_WRITE], toggle->written - toggle->issued);
+	if (toggle->event > toggle->written)
+		hist_record (&hist[STAGE_KERNEL], toggle->event - toggle->written);
+	if (toggle->event && painted)
+		hist_record (&hist[STAGE_PAINT], painted - toggle->event);
+	hist_record (&hist[STAGE_TOTAL],
+		     MAX (painted, MAX (toggle->event, toggle->written)) - toggle->notify);
+	toggle->active = FALSE;
+}
+
+static void
+expire_pending (gint64 now)
+{
+	guint i;
+
+	for (i = 0; i < N_PENDING; i++)
+		if (pending[i].active && now - pending[i].notify > PENDING_USEC) {
+			pending[i].active = FALSE;
+			incomplete++;
+		}
+}
+
+static PendingToggle *
+find_pending (guint32 idx)
+{
+	guint i;
+
+	for (i = 0; i < N_PENDING; i++)
+		if (pending[i].active && pending[i].idx == idx)
+			return &pending[i];
+
+	return NULL;
+}
+
+void
+latency_toggle_start (guint32 idx,
+		      guint8  type)
+{
+	PendingToggle *toggle;
+	guint i;
+
+	expire_pending (g_get_monotonic_time ());
+	toggle = find_pending (idx);
+	if (toggle != NULL) {
+		/* the previous toggle of this device never completed */
+		incomplete++;
+	} else {
+		for (i = 0; i < N_PENDING && pending[i].active; i++)
+			;
+		if (i == N_PENDING) {
+			incomplete++;
+			return;
+		}
+		toggle = &pending[i];
+	}
+
+	memset (toggle, 0, sizeof (PendingToggle));
+	toggle->active = TRUE;
+	toggle->idx = idx;
+	toggle->type = MIN (type, NUM_RFKILL_TYPES - 1);
+	toggle->notify = g_get_monotonic_time ();
+}
+
+void
+latency_write_issued (guint32 idx)
+{
+	PendingToggle *toggle = find_pending (idx);
+
+	if (toggle != NULL)
+		toggle->issued = g_get_monotonic_time ();
+}
+
+/* for rfkill(8) this is when the child was reaped */
+void
+latency_write_done (guint32 idx)
+{
+	PendingToggle *toggle = find_pending (idx);
+
+	if (toggle == NULL)
+		return;
+
+	toggle->written = g_get_monotonic_time ();
+	/* the event beat the reaping, the frame can't be told apart */
+	if (toggle->event)
+		finish (toggle, 0);
+}
+
+/* @painting: a frame showing the new state is queued, else end here */
+void
+latency_event (guint32  idx,
+	       gboolean painting)
+{
+	PendingToggle *toggle = find_pending (idx);
+
+	if (toggle == NULL || toggle->event)
+		return;
+
+	toggle->event = g_get_monotonic_time ();
+	if (toggle->written && !painting)
+		finish (toggle, 0);
+}
+
+void
+latency_frame (void)
+{
+	PendingToggle *toggle;
+	gint64 now = g_get_monotonic_time ();
+	guint i;
+
+	expire_pending (now);
+
+	for (i = 0; i < N_PENDING; i++) {
+		toggle = &pending[i];
+		if (!toggle->active || !toggle->written)
+			continue;
+		/* without the event watch there is no kernel stage to wait for */
+		if (!toggle->event && rfkill_event_watching ())
+			continue;
+
+		finish (toggle, now);
+	}
+}
+
+void
+latency_report (void)
+{
+	const LatencyHist *hist;
+	guint type;
+	guint stage;
+
+	g_printerr ("grfkill toggle latency (usec)\n");
+	g_printerr ("%-10s %-7s %7s %9s %9s %9s %9s\n",
+		    "type", "stage", "count", "p50", "p90", "p99", "max");
+
+	for (type = 0; type < NUM_RFKILL_TYPES; type++) {
+		for (stage = 0; stage < N_STAGES; stage++) {
+			hist = &hists[type][stage];
+			if (hist->total == 0)
+				continue;
+			g_printerr ("%-10s %-7s %7u %9" G_GUINT64_FORMAT " %9" G_GUINT64_FORMAT
+				    " %9" G_GUINT64_FORMAT " %9" G_GUINT64_FORMAT "\n",
+				    rfkill_type_name (type), stage_names[stage], hist->total,
+				    hist_percentile (hist, 50), hist_percentile (hist, 90),
+				    hist_percentile (hist, 99), hist->max);
+		}
+	}
+
+	if (incomplete)
+		g_printerr ("%u toggles never completed\n", incomplete);
+}
@@ -1,428 +0,0 @@
-/* GdkPixbuf RGBA C-Source image dump 1-byte-run-length-encoded */
-
-static const GdkPixdata wlan_blocked_inline = {
-  0x47646b50, /* Pixbuf magic: 'GdkP' */
-  24 + 9558, /* header length + pixel_data length */
-  0x2010002, /* pixdata_type */
-  512, /* rowstride */
-  128, /* width */
-  128, /* height */
-  /* pixel_data: */
-  "\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0"
-  "\0\0\234\0\0\0\0\2\314\314\314(\303\303\303\21\320\0\0\0\0\2\317\317"
-  "\317\20\313\313\313'\253\0\0\0\0\4\322\322\322\"\315\315\315V\315\315"
-  "\315R\312\312\312\30\316\0\0\0\0\4\312\312\312\30\313\313\313S\315\315"
-  "\315V\313\313\313\"\251\0\0\0\0\2\321\321\321\26\315\315\315V\202\313"
-  "\313\313X\2\312\312\312V\314\314\314\36\314\0\0\0\0\2\314\314\314\36"
-  "\314\314\314U\202\315\315\315W\2\317\317\317U\316\316\316\25\247\0\0"
-  "\0\0\2\325\325\325\14\315\315\315R\204\313\313\313Y\2\313\313\313X\315"
-  "\315\315$\312\0\0\0\0\1\313\313\313'\205\313\313\313Y\2\315\315\315Q"
-  "\314\314\314\12\245\0\0\0\0\2\377\377\377\1\314\314\314F\206\315\315"
-  "\315[\2\313\313\313N\377\377\377\2\310\0\0\0\0\2\377\377\377\2\315\315"
-  "\315M\206\314\314\314Z\2\316\316\316D\377\377\377\1\244\0\0\0\0\1\316"
-  "\316\316/\206\315\315\315\\\2\316\316\316T\325\325\325\14\312\0\0\0\0"
-  "\2\325\325\325\14\314\314\314U\206\315\315\315\\\1\315\315\315.\243\0"
-  "\0\0\0\2\310\310\310\27\312\312\312\\\205\313\313\313]\2\314\314\314"
-  "Z\321\321\321\26\314\0\0\0\0\2\321\321\321\26\312\312\312[\205\313\313"
-  "\313]\2\312\312\312\\\314\314\314\24\241\0\0\0\0\2\277\277\277\4\314"
-  "\314\314P\206\314\314\314_\1\307\307\307)\316\0\0\0\0\1\315\315\315)"
-  "\206\314\314\314_\2\314\314\314P\277\277\277\4\240\0\0\0\0\1\312\312"
-  "\3125\206\315\315\315`\1\316\316\316C\320\0\0\0\0\1\316\316\316D\206"
-  "\315\315\315`\1\311\311\3114\237\0\0\0\0\2\317\317\317\20\315\315\315"
-  "`\205\313\313\313b\2\313\313\313Y\277\277\277\10\320\0\0\0\0\2\277\277"
-  "\277\10\316\316\316X\205\315\315\315a\2\314\314\314_\333\333\333\16\236"
-  "\0\0\0\0\1\313\313\313E\206\313\313\313c\1\310\310\310\34\322\0\0\0\0"
-  "\1\314\314\314\36\206\313\313\313c\1\313\313\313D\235\0\0\0\0\1\314\314"
-  "\314\31\206\315\315\315e\1\314\314\314A\324\0\0\0\0\1\315\315\315B\206"
-  "\314\314\314d\1\310\310\310\27\234\0\0\0\0\1\315\315\315Q\205\315\315"
-  "\315f\2\313\313\313b\321\321\321\13\324\0\0\0\0\2\277\277\277\14\316"
-  "\316\316b\205\315\315\315f\1\314\314\314P\233\0\0\0\0\1\312\312\312\35"
-  "\206\314\314\314h\1\311\311\3114\220\0\0\0\0\1\306\306\306\11\264\0\0"
-  "\0\0\1\306\306\306\11\220\0\0\0\0\1\312\312\3125\206\313\313\313g\1\320"
-  "\320\320\33\232\0\0\0\0\1\313\313\313N\205\314\314\314i\2\312\312\312"
-  "\\\377\377\377\3\217\0\0\0\0\3\321\321\321\26\315\315\315e\312\312\312"
-  "0\262\0\0\0\0\3\312\312\3120\315\315\315e\305\305\305\26\217\0\0\0\0"
-  "\2\277\277\277\4\315\315\315\\\205\314\314\314i\1\312\312\312M\231\0"
-  "\0\0\0\1\327\327\327\23\206\315\315\315k\1\315\315\315)\217\0\0\0\0\2"
-  "\306\306\306\11\313\313\313]\202\314\314\314j\1\315\315\3153\260\0\0"
-  "\0\0\1\311\311\3114\202\314\314\314j\2\315\315\315\\\337\337\337\10\217"
-  "\0\0\0\0\1\316\316\316*\206\314\314\314j\1\325\325\325\22\230\0\0\0\0"
-  "\1\313\313\313D\205\313\313\313l\2\315\315\315a\252\252\252\3\216\0\0"
-  "\0\0\2\377\377\377\1\314\314\314P\204\313\313\313l\1\311\311\311=\256"
-  "\0\0\0\0\1\311\311\311=\204\313\313\313l\1\313\313\313O\217\0\0\0\0\2"
-  "\377\377\377\3\313\313\313b\205\313\313\313l\1\312\312\312C\227\0\0\0"
-  "\0\3\306\306\306\11\315\315\315k\314\314\314n\204\314\314\314m\1\312"
-  "\312\3125\217\0\0\0\0\1\314\314\3142\206\314\314\314m\1\314\314\314A"
-  "\254\0\0\0\0\1\314\314\314A\206\314\314\314m\1\312\312\3120\217\0\0\0"
-  "\0\1\317\317\3175\205\314\314\314m\2\314\314\314j\306\306\306\11\226"
-  "\0\0\0\0\1\315\315\315.\205\314\314\314o\2\315\315\315k\337\337\337\10"
-  "\216\0\0\0\0\2\314\314\314\24\315\315\315l\205\314\314\314o\2\314\314"
-  "\314n\315\315\315$\254\0\0\0\0\1\310\310\310%\206\314\314\314o\2\313"
-  "\313\313l\311\311\311\23\216\0\0\0\0\2\306\306\306\11\315\315\315k\205"
-  "\314\314\314o\1\314\314\314-\226\0\0\0\0\1\314\314\314U\205\315\315\315"
-  "p\1\316\316\316C\217\0\0\0\0\1\315\315\315V\206\315\315\315p\1\317\317"
-  "\3175\256\0\0\0\0\1\320\320\3206\206\315\315\315p\1\314\314\314U\217"
-  "\0\0\0\0\1\313\313\313D\205\315\315\315p\1\313\313\313T\225\0\0\0\0\1"
-  "\310\310\310\16\206\314\314\314r\1\314\314\314\31\216\0\0\0\0\1\307\307"
-  "\307)\206\314\314\314r\1\314\314\314P\260\0\0\0\0\1\315\315\315Q\206"
-  "\314\314\314r\1\313\313\313'\216\0\0\0\0\1\316\316\316\32\206\313\313"
-  "\313q\1\310\310\310\16\224\0\0\0\0\1\311\311\3114\205\314\314\314s\1"
-  "\315\315\315e\216\0\0\0\0\2\377\377\377\3\314\314\314d\205\314\314\314"
-  "s\2\313\313\313l\304\304\304\15\260\0\0\0\0\2\310\310\310\16\314\314"
-  "\314m\205\314\314\314s\2\313\313\313c\252\252\252\3\215\0\0\0\0\2\377"
-  "\377\377\1\315\315\315f\205\314\314\314s\1\314\314\3142\224\0\0\0\0\1"
-  "\316\316\316Y\205\315\315\315u\1\316\316\316\77\216\0\0\0\0\1\314\314"
-  "\314-\206\315\315\315u\1\312\312\3120\262\0\0\0\0\1\313\313\3131\206"
-  "\314\314\314t\1\312\312\312+\216\0\0\0\0\1\313\313\313@\205\314\314\314"
-  "t\1\315\315\315W\223\0\0\0\0\2\277\277\277\4\312\312\312s\205\313\313"
-  "\313v\1\310\310\310\27\216\0\0\0\0\1\313\313\313b\205\313\313\313v\2"
-  "\312\312\312a\377\377\377\1\262\0\0\0\0\2\200\200\200\2\313\313\313b"
-  "\205\313\313\313v\1\312\312\312a\216\0\0\0\0\1\314\314\314\31\205\313"
-  "\313\313v\2\314\314\314r\377\377\377\3\222\0\0\0\0\1\314\314\314\36\205"
-  "\314\314\314x\1\314\314\314m\216\0\0\0\0\1\313\313\313\"\206\314\314"
-  "\314x\1\311\311\311!\264\0\0\0\0\1\314\314\314#\206\314\314\314w\1\311"
-  "\311\311!\216\0\0\0\0\1\314\314\314m\205\314\314\314w\1\310\310\310\34"
-  "\222\0\0\0\0\1\314\314\314<\205\314\314\314y\1\314\314\314P\216\0\0\0"
-  "\0\1\312\312\312R\205\314\314\314y\1\314\314\314_\266\0\0\0\0\1\313\313"
-  "\313b\205\314\314\314y\1\314\314\314P\216\0\0\0\0\1\315\315\315Q\205"
-  "\314\314\314y\1\317\317\317:\222\0\0\0\0\1\313\313\313Y\205\313\313\313"
-  "{\1\312\312\3125\215\0\0\0\0\2\325\325\325\6\313\313\313v\205\313\313"
-  "\313{\1\314\314\314-\266\0\0\0\0\1\315\315\315.\205\315\315\315z\2\315"
-  "\315\315u\314\314\314\5\215\0\0\0\0\1\313\313\3136\205\315\315\315z\1"
-  "\315\315\315W\222\0\0\0\0\1\313\313\313u\205\314\314\314|\1\310\310\310"
-  "\27\215\0\0\0\0\1\313\313\313,\205\314\314\314|\2\315\315\315u\277\277"
-  "\277\4\266\0\0\0\0\2\314\314\314\5\313\313\313v\205\314\314\314|\1\312"
-  "\312\312+\215\0\0\0\0\1\312\312\312\30\205\314\314\314|\1\314\314\314"
-  "t\221\0\0\0\0\1\325\325\325\14\205\314\314\314~\2\314\314\314x\377\377"
-  "\377\1\215\0\0\0\0\1\314\314\314P\205\314\314\314}\1\316\316\316N\227"
-  "\0\0\0\0\4\377\377\377\3\314\314\314-\314\314\314U\315\315\315l\202\313"
-  "\313\313u\4\315\315\315l\313\313\313T\314\314\314-\377\377\377\3\227"
-  "\0\0\0\0\1\314\314\314P\205\314\314\314}\1\316\316\316N\215\0\0\0\0\2"
-  "\377\377\377\1\314\314\314x\205\314\314\314}\1\321\321\321\13\220\0\0"
-  "\0\0\1\314\314\314\36\205\315\315\315\177\1\313\313\313g\216\0\0\0\0"
-  "\1\315\315\315p\205\315\315\315\177\1\317\317\317%\226\0\0\0\0\2\316"
-  "\316\316*\314\314\314o\210\315\315\315\177\2\314\314\314o\315\315\315"
-  ")\226\0\0\0\0\1\313\313\313'\205\315\315\315\177\1\314\314\314o\216\0"
-  "\0\0\0\1\316\316\316h\205\315\315\315\177\1\323\323\323\35\220\0\0\0"
-  "\0\1\313\313\3131\205\313\313\313\200\1\314\314\314U\215\0\0\0\0\1\317"
-  "\317\317\20\205\313\313\313\200\2\312\312\312~\325\325\325\6\224\0\0"
-  "\0\0\2\200\200\200\2\313\313\313I\214\313\313\313\200\2\312\312\312H"
-  "\200\200\200\2\224\0\0\0\0\2\277\277\277\10\314\314\314~\205\313\313"
-  "\313\200\1\314\314\314\17\215\0\0\0\0\1\315\315\315V\205\313\313\313"
-  "\200\1\312\312\3120\220\0\0\0\0\1\313\313\313E\205\314\314\314\202\1"
-  "\313\313\313D\215\0\0\0\0\1\320\320\320+\205\314\314\314\202\1\313\313"
-  "\313g\225\0\0\0\0\1\315\315\315H\216\314\314\314\202\1\315\315\315G\225"
-  "\0\0\0\0\1\314\314\314i\205\314\314\314\202\1\312\312\312+\215\0\0\0"
-  "\0\1\313\313\313E\205\314\314\314\201\1\316\316\316C\220\0\0\0\0\1\315"
-  "\315\315W\205\314\314\314\203\1\320\320\3201\215\0\0\0\0\1\316\316\316"
-  "\77\205\314\314\314\203\1\315\315\315L\224\0\0\0\0\1\315\315\315)\217"
-  "\314\314\314\203\2\316\316\316\202\314\314\314(\224\0\0\0\0\1\315\315"
-  "\315M\205\314\314\314\203\1\316\316\316>\215\0\0\0\0\1\315\315\3153\205"
-  "\314\314\314\203\1\315\315\315V\220\0\0\0\0\1\312\312\312a\205\313\313"
-  "\313\205\1\315\315\315$\215\0\0\0\0\1\316\316\316S\205\313\313\313\205"
-  "\1\311\311\3119\223\0\0\0\0\2\252\252\252\3\312\312\312s\220\313\313"
-  "\313\205\2\314\314\314r\252\252\252\3\223\0\0\0\0\1\316\316\3169\205"
-  "\315\315\315\204\1\315\315\315R\215\0\0\0\0\1\317\317\317%\205\315\315"
-  "\315\204\1\314\314\314_\220\0\0\0\0\1\314\314\314h\205\314\314\314\206"
-  "\1\312\312\312\35\215\0\0\0\0\1\313\313\313f\205\314\314\314\206\1\317"
-  "\317\317%\223\0\0\0\0\1\315\315\315.\222\314\314\314\206\1\314\314\314"
-  "-\223\0\0\0\0\1\313\313\313'\205\314\314\314\206\1\315\315\315e\215\0"
-  "\0\0\0\1\316\316\316\37\205\314\314\314\206\1\315\315\315f\220\0\0\0"
-  "\0\1\315\315\315p\205\314\314\314\210\1\312\312\312\30\215\0\0\0\0\1"
-  "\315\315\315p\205\314\314\314\210\1\312\312\312\30\223\0\0\0\0\1\314"
-  "\314\314Z\206\314\314\314\210\214\314\314\314\207\1\315\315\315W\223"
-  "\0\0\0\0\1\314\314\314\31\205\314\314\314\207\1\314\314\314n\215\0\0"
-  "\0\0\1\314\314\314\31\205\314\314\314\207\1\314\314\314n\220\0\0\0\0"
-  "\1\316\316\316w\205\315\315\315\211\1\322\322\322\21\215\0\0\0\0\1\316"
-  "\316\316w\205\315\315\315\211\1\306\306\306\22\223\0\0\0\0\1\313\313"
-  "\313v\222\315\315\315\211\1\314\314\314t\223\0\0\0\0\1\311\311\311\23"
-  "\205\315\315\315\211\1\315\315\315v\215\0\0\0\0\1\325\325\325\22\205"
-  "\315\315\315\211\1\315\315\315v\220\0\0\0\0\1\313\313\313\177\205\314"
-  "\314\314\213\1\321\321\321\13\215\0\0\0\0\1\313\313\313\177\205\314\314"
-  "\314\213\1\325\325\325\14\223\0\0\0\0\1\312\312\312\203\222\313\313\313"
-  "\212\1\314\314\314\202\223\0\0\0\0\1\325\325\325\14\205\313\313\313\212"
-  "\1\312\312\312~\215\0\0\0\0\1\277\277\277\14\205\313\313\313\212\1\312"
-  "\312\312~\220\0\0\0\0\1\315\315\315\200\205\314\314\314\214\1\325\325"
-  "\325\14\215\0\0\0\0\1\315\315\315\200\205\314\314\314\214\1\277\277\277"
-  "\14\223\0\0\0\0\1\314\314\314\206\222\314\314\314\214\1\313\313\313\205"
-  "\223\0\0\0\0\1\325\325\325\14\205\314\314\314\214\1\313\313\313\200\215"
-  "\0\0\0\0\1\304\304\304\15\205\314\314\314\214\1\313\313\313\200\220\0"
-  "\0\0\0\1\315\315\315{\205\315\315\315\216\1\311\311\311\23\215\0\0\0"
-  "\0\1\315\315\315z\205\314\314\314\215\1\325\325\325\22\223\0\0\0\0\1"
-  "\314\314\314x\222\314\314\314\215\1\314\314\314w\223\0\0\0\0\1\327\327"
-  "\327\23\205\314\314\314\215\1\313\313\313z\215\0\0\0\0\1\314\314\314"
-  "\24\205\314\314\314\215\1\313\313\313z\220\0\0\0\0\1\313\313\313v\205"
-  "\313\313\313\217\1\316\316\316\32\215\0\0\0\0\1\313\313\313u\205\313"
-  "\313\313\217\1\314\314\314\31\223\0\0\0\0\1\313\313\313^\222\313\313"
-  "\313\217\1\313\313\313]\223\0\0\0\0\1\316\316\316\32\205\313\313\313"
-  "\217\1\314\314\314t\215\0\0\0\0\1\316\316\316\32\205\313\313\313\217"
-  "\1\313\313\313u\220\0\0\0\0\1\314\314\314o\205\314\314\314\220\1\311"
-  "\311\311!\215\0\0\0\0\1\314\314\314m\205\314\314\314\220\1\314\314\314"
-  "(\223\0\0\0\0\1\314\314\3142\222\314\314\314\220\1\312\312\3120\223\0"
-  "\0\0\0\1\310\310\310*\205\314\314\314\220\1\313\313\313l\215\0\0\0\0"
-  "\1\313\313\313\"\205\314\314\314\220\1\314\314\314n\220\0\0\0\0\1\314"
-  "\314\314j\205\314\314\314\222\1\315\315\315)\215\0\0\0\0\1\315\315\315"
-  "[\205\314\314\314\222\1\316\316\316>\223\0\0\0\0\2\377\377\377\3\314"
-  "\314\314~\220\314\314\314\222\2\314\314\314}\252\252\252\3\223\0\0\0"
-  "\0\1\313\313\313@\205\314\314\314\222\1\314\314\314Z\215\0\0\0\0\1\310"
-  "\310\310*\205\314\314\314\221\1\314\314\314h\220\0\0\0\0\1\315\315\315"
-  "a\205\315\315\315\223\1\312\312\312:\215\0\0\0\0\1\314\314\314F\205\315"
-  "\315\315\223\1\314\314\314U\224\0\0\0\0\1\315\315\315.\217\315\315\315"
-  "\223\2\316\316\316\222\321\321\321,\224\0\0\0\0\1\315\315\315V\205\315"
-  "\315\315\223\1\317\317\317E\215\0\0\0\0\1\313\313\313;\205\315\315\315"
-  "\223\1\314\314\314_\220\0\0\0\0\1\313\313\313N\205\314\314\314\225\1"
-  "\313\313\313O\215\0\0\0\0\1\314\314\3142\205\314\314\314\225\1\313\313"
-  "\313v\225\0\0\0\0\1\315\315\315R\216\314\314\314\225\1\315\315\315Q\225"
-  "\0\0\0\0\1\314\314\314w\205\313\313\313\224\1\312\312\3120\215\0\0\0"
-  "\0\1\314\314\314P\205\313\313\313\224\1\315\315\315L\220\0\0\0\0\1\316"
-  "\316\3169\205\314\314\314\226\1\313\313\313f\215\0\0\0\0\1\311\311\311"
-  "\23\205\314\314\314\226\2\313\313\313\224\333\333\333\7\224\0\0\0\0\2"
-  "\200\200\200\2\314\314\314U\214\314\314\314\226\2\313\313\313T\200\200"
-  "\200\2\224\0\0\0\0\2\306\306\306\11\315\315\315\224\205\314\314\314\226"
-  "\1\306\306\306\22\215\0\0\0\0\1\313\313\313g\205\314\314\314\226\1\314"
-  "\314\3147\220\0\0\0\0\1\315\315\315$\205\315\315\315\230\1\314\314\314"
-  "}\216\0\0\0\0\1\316\316\316\206\205\315\315\315\230\1\313\313\313,\226"
-  "\0\0\0\0\2\314\314\3142\315\315\315\205\203\315\315\315\230\205\314\314"
-  "\314\227\2\314\314\314\203\313\313\3131\226\0\0\0\0\1\315\315\315.\205"
-  "\314\314\314\227\1\315\315\315\204\216\0\0\0\0\1\314\314\314}\205\314"
-  "\314\314\227\1\322\322\322\"\220\0\0\0\0\1\310\310\310\16\205\313\313"
-  "\313\231\2\313\313\313\223\377\377\377\2\215\0\0\0\0\1\313\313\313b\205"
-  "\313\313\313\231\1\315\315\315`\227\0\0\0\0\4\277\277\277\4\312\312\312"
-  "5\312\312\312a\313\313\313\200\202\313\313\313\224\4\313\313\313\200"
-  "\315\315\315`\316\316\3164\277\277\277\4\227\0\0\0\0\1\313\313\313b\205"
-  "\313\313\313\231\1\315\315\315`\215\0\0\0\0\2\377\377\377\2\313\313\313"
-  "\224\205\313\313\313\231\1\330\330\330\15\221\0\0\0\0\1\314\314\314\222"
-  "\205\314\314\314\233\1\307\307\307\40\215\0\0\0\0\1\314\314\3147\205"
-  "\314\314\314\233\2\314\314\314\222\314\314\314\5\266\0\0\0\0\2\325\325"
-  "\325\6\313\313\313\223\205\314\314\314\232\1\312\312\3125\215\0\0\0\0"
-  "\1\321\321\321!\205\314\314\314\232\1\314\314\314\220\222\0\0\0\0\1\315"
-  "\315\315q\205\314\314\314\234\1\314\314\314F\215\0\0\0\0\2\333\333\333"
-  "\7\314\314\314\226\205\314\314\314\234\1\313\313\313;\266\0\0\0\0\1\315"
-  "\315\315=\205\314\314\314\234\2\315\315\315\225\266\266\266\7\215\0\0"
-  "\0\0\1\315\315\315G\205\314\314\314\234\1\314\314\314o\222\0\0\0\0\1"
-  "\311\311\311L\205\313\313\313\236\1\314\314\314n\216\0\0\0\0\1\315\315"
-  "\315f\205\315\315\315\235\2\315\315\315\205\377\377\377\1\264\0\0\0\0"
-  "\2\200\200\200\2\314\314\314\210\205\315\315\315\235\1\315\315\315e\216"
-  "\0\0\0\0\1\314\314\314o\205\315\315\315\235\1\316\316\316I\222\0\0\0"
-  "\0\1\313\313\313'\205\314\314\314\237\2\315\315\315\223\0\0\0\1\215\0"
-  "\0\0\0\1\310\310\310.\206\314\314\314\237\1\313\313\3131\264\0\0\0\0"
-  "\1\310\310\3103\206\314\314\314\237\1\313\313\313,\215\0\0\0\0\2\377"
-  "\377\377\1\315\315\315\224\205\314\314\314\237\1\317\317\317%\222\0\0"
-  "\0\0\2\325\325\325\6\313\313\313\234\205\314\314\314\240\1\314\314\314"
-  "#\215\0\0\0\0\2\377\377\377\1\313\313\313\205\205\314\314\314\240\2\314"
-  "\314\314\206\252\252\252\3\262\0\0\0\0\2\377\377\377\3\313\313\313\210"
-  "\205\314\314\314\240\2\313\313\313\204\377\377\377\1\215\0\0\0\0\1\317"
-  "\317\317%\205\314\314\314\240\2\314\314\314\233\377\377\377\4\223\0\0"
-  "\0\0\1\314\314\314|\205\315\315\315\242\1\315\315\315[\216\0\0\0\0\1"
-  "\316\316\316>\206\315\315\315\242\1\316\316\316C\262\0\0\0\0\1\314\314"
-  "\314F\206\315\315\315\242\1\314\314\314<\216\0\0\0\0\1\315\315\315\\"
-  "\205\314\314\314\241\1\314\314\314y\224\0\0\0\0\1\313\313\313J\205\313"
-  "\313\313\243\2\313\313\313\222\377\377\377\1\215\0\0\0\0\2\377\377\377"
-  "\4\313\313\313\216\205\313\313\313\243\2\313\313\313\231\306\306\306"
-  "\22\227\0\0\0\0\2\314\314\314\17\312\312\312\30\227\0\0\0\0\2\314\314"
-  "\314\24\314\314\314\232\205\313\313\313\243\2\313\313\313\215\277\277"
-  "\277\4\215\0\0\0\0\2\377\377\377\1\313\313\313\223\205\313\313\313\243"
-  "\1\315\315\315G\224\0\0\0\0\2\317\317\317\20\313\313\313\243\205\314"
-  "\314\314\245\1\312\312\312+\216\0\0\0\0\1\316\316\3164\206\314\314\314"
-  "\245\2\314\314\314~\377\377\377\1\226\0\0\0\0\2\312\312\312:\312\312"
-  "\312C\226\0\0\0\0\2\377\377\377\2\313\313\313\177\206\314\314\314\244"
-  "\1\314\314\3142\216\0\0\0\0\1\312\312\312+\205\314\314\314\244\2\313"
-  "\313\313\242\314\314\314\17\225\0\0\0\0\1\314\314\314~\205\314\314\314"
-  "\246\1\314\314\314d\216\0\0\0\0\2\377\377\377\1\313\313\313\200\206\314"
-  "\314\314\246\1\313\313\313O\226\0\0\0\0\2\313\313\313b\315\315\315k\226"
-  "\0\0\0\0\1\315\315\315Q\206\314\314\314\246\1\314\314\314~\217\0\0\0"
-  "\0\1\315\315\315e\205\314\314\314\246\1\316\316\316|\226\0\0\0\0\1\313"
-  "\313\313E\205\313\313\313\250\2\313\313\313\242\310\310\310\16\216\0"
-  "\0\0\0\2\314\314\314\36\313\313\313\243\205\313\313\313\250\2\313\313"
-  "\313\247\313\313\3136\225\0\0\0\0\2\313\313\313\215\314\314\314\226\225"
-  "\0\0\0\0\2\314\314\3147\314\314\314\246\205\315\315\315\247\2\315\315"
-  "\315\242\312\312\312\35\216\0\0\0\0\2\314\314\314\17\315\315\315\242"
-  "\205\315\315\315\247\1\316\316\316C\226\0\0\0\0\2\310\310\310\16\314"
-  "\314\314\245\205\314\314\314\251\1\314\314\314U\217\0\0\0\0\1\312\312"
-  "\312M\206\314\314\314\251\1\312\312\312e\224\0\0\0\0\4\317\317\317\20"
-  "\313\313\313\250\314\314\314\251\314\314\314\31\224\0\0\0\0\1\315\315"
-  "\315e\206\314\314\314\251\1\313\313\313J\217\0\0\0\0\1\312\312\312W\205"
-  "\314\314\314\251\2\314\314\314\244\330\330\330\15\227\0\0\0\0\1\313\313"
-  "\313l\205\314\314\314\253\2\313\313\313\236\266\266\266\7\216\0\0\0\0"
-  "\2\377\377\377\1\315\315\315\177\204\314\314\314\253\2\315\315\315`\377"
-  "\377\377\1\224\0\0\0\0\1\312\312\312:\202\314\314\314\252\1\312\312\312"
-  "C\224\0\0\0\0\2\377\377\377\1\314\314\314_\204\314\314\314\252\2\314"
-  "\314\314|\377\377\377\1\216\0\0\0\0\2\333\333\333\7\313\313\313\236\205"
-  "\314\314\314\252\1\314\314\314i\230\0\0\0\0\2\316\316\316\37\314\314"
-  "\314\253\205\315\315\315\254\1\313\313\313I\217\0\0\0\0\2\314\314\314"
-  "\17\316\316\316\226\202\315\315\315\254\1\316\316\316S\226\0\0\0\0\1"
-  "\315\315\315f\202\315\315\315\254\1\314\314\314o\226\0\0\0\0\1\313\313"
-  "\313T\202\315\315\315\254\2\314\314\314\226\330\330\330\15\217\0\0\0"
-  "\0\1\315\315\315L\205\315\315\315\254\2\314\314\314\253\314\314\314\36"
-  "\231\0\0\0\0\1\314\314\314|\205\314\314\314\256\2\315\315\315\242\325"
-  "\325\325\14\217\0\0\0\0\3\320\320\320\33\314\314\314\237\316\316\316"
-  ">\227\0\0\0\0\1\313\313\313\223\202\313\313\313\255\1\313\313\313\234"
-  "\227\0\0\0\0\3\316\316\316>\314\314\314\237\316\316\316\32\217\0\0\0"
-  "\0\2\304\304\304\15\314\314\314\241\205\313\313\313\255\1\312\312\312"
-  "y\232\0\0\0\0\1\313\313\3131\206\314\314\314\257\1\313\313\313]\220\0"
-  "\0\0\0\1\314\314\314\17\227\0\0\0\0\2\317\317\317\20\314\314\314\256"
-  "\203\314\314\314\257\1\314\314\314\31\227\0\0\0\0\1\314\314\314\17\220"
-  "\0\0\0\0\1\314\314\314_\206\314\314\314\257\1\315\315\315.\232\0\0\0"
-  "\0\2\377\377\377\1\314\314\314\214\205\314\314\314\260\2\316\316\316"
-  "\252\321\321\321\26\247\0\0\0\0\1\315\315\315=\204\314\314\314\260\1"
-  "\313\313\313E\247\0\0\0\0\2\310\310\310\27\314\314\314\253\205\314\314"
-  "\314\260\1\315\315\315\211\234\0\0\0\0\1\320\320\320+\206\313\313\313"
-  "\262\1\314\314\314w\247\0\0\0\0\1\314\314\314j\204\313\313\313\262\1"
-  "\314\314\314r\247\0\0\0\0\1\314\314\314x\203\313\313\313\262\202\315"
-  "\315\315\261\2\314\314\314\260\314\314\314(\235\0\0\0\0\1\313\313\313"
-  "v\206\314\314\314\263\1\314\314\314A\246\0\0\0\0\1\313\313\313\231\204"
-  "\314\314\314\263\1\314\314\314\241\246\0\0\0\0\1\312\312\312C\206\314"
-  "\314\314\263\1\314\314\314t\236\0\0\0\0\2\310\310\310\27\314\314\314"
-  "\257\205\314\314\314\265\2\314\314\314\252\316\316\316\25\244\0\0\0\0"
-  "\1\311\311\311\23\206\314\314\314\265\1\320\320\320\33\244\0\0\0\0\2"
-  "\321\321\321\26\314\314\314\252\205\314\314\314\264\2\313\313\313\255"
-  "\314\314\314\24\237\0\0\0\0\1\314\314\314d\206\315\315\315\266\2\314"
-  "\314\314\203\377\377\377\1\243\0\0\0\0\1\313\313\313@\206\315\315\315"
-  "\266\1\315\315\315G\243\0\0\0\0\2\377\377\377\1\313\313\313\205\206\315"
-  "\315\315\266\1\313\313\313b\240\0\0\0\0\2\333\333\333\7\314\314\314\234"
-  "\206\314\314\314\270\1\313\313\313S\243\0\0\0\0\1\314\314\314n\206\314"
-  "\314\314\270\1\313\313\313v\243\0\0\0\0\1\314\314\314U\206\313\313\313"
-  "\267\2\314\314\314\232\333\333\333\7\241\0\0\0\0\2\314\314\314#\314\314"
-  "\314\265\205\314\314\314\271\2\314\314\314\270\312\312\312\77\242\0\0"
-  "\0\0\1\314\314\314\237\206\314\314\314\271\1\313\313\313\247\242\0\0"
-  "\0\0\2\313\313\313@\314\314\314\270\205\314\314\314\271\2\314\314\314"
-  "\263\316\316\316\37\243\0\0\0\0\1\315\315\315W\206\315\315\315\273\2"
-  "\315\315\315\264\313\313\313'\240\0\0\0\0\1\321\321\321\26\210\314\314"
-  "\314\272\1\320\320\320\33\240\0\0\0\0\2\321\321\321'\315\315\315\263"
-  "\206\314\314\314\272\1\314\314\314U\244\0\0\0\0\2\252\252\252\3\314\314"
-  "\314\221\206\313\313\313\274\2\314\314\314\244\333\333\333\7\237\0\0"
-  "\0\0\1\311\311\311B\210\313\313\313\274\1\313\313\313I\237\0\0\0\0\2"
-  "\333\333\333\7\314\314\314\244\206\313\313\313\274\2\313\313\313\217"
-  "\377\377\377\2\245\0\0\0\0\2\306\306\306\22\315\315\315\250\204\314\314"
-  "\314\276\2\314\314\314\271\316\316\316C\240\0\0\0\0\1\314\314\314s\210"
-  "\314\314\314\275\1\313\313\313z\240\0\0\0\0\2\313\313\313D\314\314\314"
-  "\271\204\314\314\314\275\2\314\314\314\244\314\314\314\17\247\0\0\0\0"
-  "\2\315\315\315$\313\313\313\267\202\314\314\314\277\2\314\314\314\270"
-  "\315\315\3158\241\0\0\0\0\1\314\314\314\244\210\314\314\314\277\1\315"
-  "\315\315\254\241\0\0\0\0\2\316\316\3169\314\314\314\270\202\314\314\314"
-  "\277\2\313\313\313\267\314\314\314#\251\0\0\0\0\4\316\316\316>\314\314"
-  "\314\277\315\315\315\262\315\315\315)\241\0\0\0\0\1\310\310\310\27\212"
-  "\315\315\315\300\1\310\310\310\34\217\0\0\0\0\3\31255C\31077\246\325"
-  "++\6\217\0\0\0\0\4\315\315\315)\315\315\315\262\315\315\315\276\315\315"
-  "\315=\215\0\0\0\0\3\325++\6\31077\247\31166B\233\0\0\0\0\2\312\312\312"
-  "[\311\311\311&\242\0\0\0\0\1\316\316\316D\212\314\314\314\302\1\314\314"
-  "\314K\216\0\0\0\0\5\30788N\31077\371\31077\377\31077\271\30699\11\217"
-  "\0\0\0\0\2\313\313\313'\314\314\314Z\215\0\0\0\0\5\30699\11\31077\271"
-  "\31077\377\31077\371\30788N\276\0\0\0\0\1\314\314\314w\212\314\314\314"
-  "\303\1\314\314\314}\215\0\0\0\0\2\31077O\31077\371\203\31077\377\2\310"
-  "77\271\30699\11\234\0\0\0\0\2\30699\11\31077\271\203\31077\377\2\310"
-  "77\371\31077O\275\0\0\0\0\1\314\314\314\252\212\315\315\315\305\1\315"
-  "\315\315\262\214\0\0\0\0\2\31166P\31077\371\205\31077\377\2\31077\271"
-  "\30699\11\232\0\0\0\0\2\30699\11\31077\271\205\31077\377\2\31077\371"
-  "\31166P\273\0\0\0\0\1\323\323\323\27\214\313\313\313\306\1\310\310\310"
-  "\34\212\0\0\0\0\2\31166Q\31077\372\207\31077\377\2\31077\271\30699\11"
-  "\230\0\0\0\0\2\30699\11\31077\271\207\31077\377\2\31077\371\31166P\272"
-  "\0\0\0\0\1\313\313\313I\214\314\314\314\310\1\313\313\313N\211\0\0\0"
-  "\0\2\30788R\31077\372\211\31077\377\2\31077\271\30699\11\226\0\0\0\0"
-  "\2\30699\11\31077\272\211\31077\377\2\31077\372\31166Q\271\0\0\0\0\1"
-  "\314\314\314|\214\314\314\314\311\1\315\315\315\200\211\0\0\0\0\1\307"
-  "88\256\213\31077\377\2\31166\262\325++\6\224\0\0\0\0\2\325++\6\31166"
-  "\262\213\31077\377\1\31077\255\271\0\0\0\0\1\314\314\314\257\214\315"
-  "\315\315\312\1\314\314\314\264\211\0\0\0\0\2\31433\5\30788\256\213\310"
-  "77\377\2\31077\271\30699\11\222\0\0\0\0\2\30699\11\31077\272\213\310"
-  "77\377\2\30788\256\31433\5\270\0\0\0\0\1\314\314\314\31\216\314\314\314"
-  "\314\1\312\312\312\35\211\0\0\0\0\2\31433\5\31077\257\213\31077\377\2"
-  "\31077\271\30699\11\220\0\0\0\0\2\30699\11\31077\272\213\31077\377\2"
-  "\30788\256\31433\5\271\0\0\0\0\1\311\311\311L\216\314\314\314\315\1\314"
-  "\314\314P\212\0\0\0\0\2\31433\5\31077\257\213\31077\377\2\31077\272\306"
-  "99\11\216\0\0\0\0\2\30699\11\31077\272\213\31077\377\2\30788\256\314"
-  "33\5\272\0\0\0\0\1\315\315\315\177\216\314\314\314\317\1\315\315\315"
-  "\204\213\0\0\0\0\2\31433\5\31077\257\213\31077\377\2\31077\272\30699"
-  "\11\214\0\0\0\0\2\30699\11\31077\272\213\31077\377\2\31077\257\31433"
-  "\5\273\0\0\0\0\1\314\314\314\265\216\314\314\314\320\1\314\314\314\271"
-  "\214\0\0\0\0\2\31433\5\31077\257\213\31077\377\2\31077\272\30699\11\212"
-  "\0\0\0\0\2\30699\11\31077\272\213\31077\377\2\31077\257\31433\5\273\0"
-  "\0\0\0\1\304\304\304\32\220\314\314\314\322\1\312\312\312\35\214\0\0"
-  "\0\0\2\325++\6\31077\260\213\31077\377\2\31077\272\30699\11\210\0\0\0"
-  "\0\2\30699\11\31077\272\213\31077\377\2\31077\257\31433\5\274\0\0\0\0"
-  "\1\313\313\313O\220\314\314\314\323\1\315\315\315R\215\0\0\0\0\2\325"
-  "++\6\31077\260\213\31077\377\2\31077\272\30699\11\206\0\0\0\0\2\3069"
-  "9\11\31077\272\213\31077\377\2\31077\257\325++\6\275\0\0\0\0\1\313\313"
-  "\313\204\220\314\314\314\325\1\314\314\314\207\216\0\0\0\0\2\325++\6"
-  "\31077\260\213\31077\377\2\31077\272\30699\11\204\0\0\0\0\2\30699\11"
-  "\31077\272\213\31077\377\2\31077\260\325++\6\276\0\0\0\0\1\314\314\314"
-  "\272\220\314\314\314\326\1\313\313\313\277\217\0\0\0\0\2\325++\6\310"
-  "77\261\213\31077\377\2\31077\272\30699\11\202\0\0\0\0\2\30699\11\310"
-  "77\272\213\31077\377\2\31077\260\325++\6\276\0\0\0\0\1\320\320\320\33"
-  "\221\314\314\314\330\2\314\314\314\327\314\314\314\36\217\0\0\0\0\2\325"
-  "++\6\31077\261\213\31077\377\4\31077\272\30699\11\321..\13\31077\301"
-  "\213\31077\377\2\31077\260\325++\6\277\0\0\0\0\1\315\315\315R\222\314"
-  "\314\314\331\1\316\316\316T\220\0\0\0\0\2\30699\11\31077\272\213\310"
-  "77\377\202\31077\264\213\31077\377\2\31077\272\30699\11\300\0\0\0\0\1"
-  "\313\313\313\210\222\314\314\314\332\1\315\315\315\212\221\0\0\0\0\2"
-  "\325++\6\31077\261\226\31077\377\2\31077\261\325++\6\301\0\0\0\0\1\315"
-  "\315\315\300\222\314\314\314\334\1\314\314\314\304\222\0\0\0\0\2\325"
-  "++\6\31166\262\224\31077\377\2\31077\261\325++\6\301\0\0\0\0\1\310\310"
-  "\310\34\224\314\314\314\335\1\323\323\323\35\222\0\0\0\0\2\325++\6\311"
-  "66\262\222\31077\377\2\31077\261\325++\6\302\0\0\0\0\1\313\313\313T\224"
-  "\314\314\314\337\1\312\312\312V\223\0\0\0\0\2\325++\6\31166\262\220\310"
-  "77\377\2\31166\262\325++\6\303\0\0\0\0\1\313\313\313\215\224\314\314"
-  "\314\340\1\314\314\314\215\224\0\0\0\0\2\325++\6\30788\263\216\31077"
-  "\377\2\31166\262\325++\6\304\0\0\0\0\1\314\314\314\310\224\314\314\314"
-  "\342\1\314\314\314\310\225\0\0\0\0\2\325++\6\30788\263\214\31077\377"
-  "\2\30788\263\325++\6\304\0\0\0\0\1\323\323\323\35\226\314\314\314\343"
-  "\1\314\314\314\36\224\0\0\0\0\2\325++\6\31077\261\214\31077\377\2\310"
-  "77\261\325++\6\304\0\0\0\0\1\315\315\315W\226\314\314\314\345\1\313\313"
-  "\313X\223\0\0\0\0\2\30699\11\31077\271\216\31077\377\2\31077\271\306"
-  "99\11\303\0\0\0\0\1\314\314\314\221\226\314\314\314\346\1\314\314\314"
-  "\221\222\0\0\0\0\2\30699\11\31077\271\220\31077\377\2\31077\271\3069"
-  "9\11\302\0\0\0\0\1\314\314\314\316\226\314\314\314\350\1\314\314\314"
-  "\315\221\0\0\0\0\2\30699\11\31077\271\222\31077\377\2\31077\271\3069"
-  "9\11\300\0\0\0\0\1\316\316\316\37\230\314\314\314\351\1\314\314\314\36"
-  "\217\0\0\0\0\2\30699\11\31077\271\224\31077\377\2\31077\271\30699\11"
-  "\277\0\0\0\0\2\314\314\314Z\314\314\314\353\227\314\314\314\352\1\313"
-  "\313\313Y\216\0\0\0\0\2\30699\11\31077\272\226\31077\377\2\31077\271"
-  "\30699\11\276\0\0\0\0\1\314\314\314\225\230\314\314\314\354\1\315\315"
-  "\315\224\215\0\0\0\0\2\325++\6\31166\262\212\31077\377\2\31077\270\310"
-  "77\261\214\31077\377\2\31166\262\325++\6\275\0\0\0\0\1\314\314\314\322"
-  "\230\314\314\314\355\1\314\314\314\322\214\0\0\0\0\2\30699\11\31077\272"
-  "\212\31077\377\4\31077\270\325++\6\252UU\3\30788\234\214\31077\377\2"
-  "\31077\271\30699\11\273\0\0\0\0\1\307\307\307\40\232\314\314\314\357"
-  "\1\316\316\316\37\212\0\0\0\0\2\30699\11\31077\272\212\31077\377\2\310"
-  "77\303\31433\12\202\0\0\0\0\2\377\0\0\1\30788\216\214\31077\377\2\310"
-  "77\271\30699\11\272\0\0\0\0\1\316\316\316]\232\314\314\314\360\1\315"
-  "\315\315[\211\0\0\0\0\2\30699\11\31077\272\212\31077\377\2\31166\316"
-  "\31433\17\205\0\0\0\0\1\30788\200\214\31077\377\2\31077\272\30699\11"
-  "\271\0\0\0\0\1\314\314\314\232\232\314\314\314\362\1\315\315\315\230"
-  "\210\0\0\0\0\2\30699\11\31077\272\212\31077\377\2\31077\327\305::\26"
-  "\207\0\0\0\0\1\30788w\214\31077\377\2\31077\272\30699\11\270\0\0\0\0"
-  "\1\314\314\314\330\232\314\314\314\363\1\314\314\314\327\207\0\0\0\0"
-  "\2\30699\11\31077\272\212\31077\377\2\31077\340\31255\35\211\0\0\0\0"
-  "\2\31166h\31077\375\213\31077\377\2\31077\272\30699\11\266\0\0\0\0\1"
-  "\313\313\313\"\234\314\314\314\365\1\316\316\316\37\205\0\0\0\0\2\306"
-  "99\11\31077\272\212\31077\377\2\31077\347\31077%\213\0\0\0\0\2\30788"
-  "[\31077\373\213\31077\377\2\31077\272\30699\11\265\0\0\0\0\1\312\312"
-  "\312`\234\314\314\314\366\1\313\313\313]\204\0\0\0\0\2\30699\11\3107"
-  "7\272\212\31077\377\2\31077\355\31077.\215\0\0\0\0\2\31077O\31166\370"
-  "\213\31077\377\2\31077\272\30699\11\264\0\0\0\0\1\314\314\314\237\232"
-  "\314\314\314\370\202\314\314\314\367\1\314\314\314\232\203\0\0\0\0\2"
-  "\30699\11\31077\272\212\31077\377\2\31077\363\310778\217\0\0\0\0\2\307"
-  "88I\31077\366\213\31077\377\2\31077\272\30699\11\263\0\0\0\0\1\313\313"
-  "\313\336\234\314\314\314\371\1\314\314\314\332\202\0\0\0\0\2\30699\11"
-  "\31077\272\212\31077\377\2\31077\367\31255C\221\0\0\0\0\2\31255>\310"
-  "77\361\213\31077\377\2\31077\272\30699\11\261\0\0\0\0\1\314\314\314#"
-  "\206\314\314\314\373\230\314\314\314\372\3\316\316\316\37\321..\13\310"
-  "77\301\212\31077\377\2\31077\373\31077O\223\0\0\0\0\2\311664\31077\354"
-  "\213\31077\377\2\31077\272\30699\11\260\0\0\0\0\1\313\313\313c\236\314"
-  "\314\314\374\2\314\314\314_\30788\256\212\31077\377\2\31077\376\3107"
-  "7f\225\0\0\0\0\2\312555\31077\354\213\31077\377\1\31077\255\260\0\0\0"
-  "\0\1\313\313\313\243\236\314\314\314\375\3\313\313\313\236\31077E\310"
-  "77\366\211\31077\377\1\31077j\227\0\0\0\0\2\31344'\31077\342\211\310"
-  "77\377\2\31077\366\30788D\260\0\0\0\0\1\314\314\314\342\236\314\314\314"
-  "\377\4\314\314\314\335\0\0\0\0\31077E\31077\366\207\31077\377\1\3078"
-  "8{\231\0\0\0\0\2\305::\37\31077\333\207\31077\377\2\31077\366\31077E"
-  "\323\0\0\0\0\2\31077E\31077\366\205\31077\377\1\31166\210\233\0\0\0\0"
-  "\2\31255\30\31077\322\205\31077\377\2\31077\366\31077E\325\0\0\0\0\2"
-  "\31077E\31077\366\203\31077\377\2\30788\227\377\0\0\1\234\0\0\0\0\2\303"
-  "<<\21\31077\311\203\31077\377\2\31077\366\31077E\327\0\0\0\0\5\31077"
-  "F\31077\367\31077\377\30788\245\377\0\0\2\236\0\0\0\0\5\31433\17\310"
-  "77\304\31077\377\31077\366\31077E\331\0\0\0\0\3\30788N\30788\263\325"
-  "++\6\240\0\0\0\0\3\31077\16\31077\273\30788N\205\0\0\0\0",
-};
-
-
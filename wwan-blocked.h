@@ -1,290 +0,0 @@
-/* GdkPixbuf RGBA C-Source image dump 1-byte-run-length-encoded */
-
-static const GdkPixdata wwan_blocked_inline = {
-  0x47646b50, /* Pixbuf magic: 'GdkP' */
-  24 + 6493, /* header length + pixel_data length */
-  0x2010002, /* pixdata_type */
-  512, /* rowstride */
-  128, /* width */
-  128, /* height */
-  /* pixel_data: */
-  "\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0"
-  "\0\0\216\0\0\0\0\1\252\252\252\3\346\314\314\314\17\1\316\316\316\25"
-  "\207\310\310\310\27\1\325\325\325\6\221\0\0\0\0\1\313\313\3136\354\314"
-  "\314\314t\1\317\317\317:\223\0\0\0\0\2\314\314\314-\316\316\316s\350"
-  "\315\315\315u\2\314\314\314t\321\321\3212\225\0\0\0\0\2\306\306\306$"
-  "\313\313\313q\210\313\313\313v\336\314\314\314w\2\314\314\314s\311\311"
-  "\311&\227\0\0\0\0\2\312\312\312\35\313\313\313p\344\314\314\314x\2\315"
-  "\315\315q\311\311\311!\231\0\0\0\0\2\311\311\311\23\314\314\314i\211"
-  "\314\314\314y\2\314\314\314x\312\312\312H\242\314\314\314A\1\312\312"
-  "\312H\206\314\314\314y\1\315\315\315[\242\314\314\314A\2\314\314\314"
-  "F\314\314\314w\211\314\314\314y\2\313\313\313l\305\305\305\26\233\0\0"
-  "\0\0\2\337\337\337\10\315\315\315\\\211\315\315\315z\2\316\316\316i\325"
-  "\325\325\22\241\0\0\0\0\1\314\314\314\17\206\315\315\315z\1\316\316\316"
-  "9\241\0\0\0\0\2\333\333\333\16\315\315\315e\211\315\315\315z\2\315\315"
-  "\315a\321\321\321\13\235\0\0\0\0\2\252\252\252\3\313\313\313O\211\313"
-  "\313\313{\2\314\314\314r\312\312\312\35\240\0\0\0\0\1\314\314\314\17"
-  "\206\313\313\313{\1\312\312\312:\240\0\0\0\0\2\312\312\312\30\312\312"
-  "\312o\211\313\313\313{\2\314\314\314U\314\314\314\5\240\0\0\0\0\1\312"
-  "\312\312\77\211\314\314\314}\2\313\313\313z\312\312\312+\237\0\0\0\0"
-  "\1\317\317\317\20\206\314\314\314}\1\313\313\313;\237\0\0\0\0\2\310\310"
-  "\310%\314\314\314w\211\314\314\314}\2\315\315\315H\377\377\377\1\242"
-  "\0\0\0\0\2\316\316\316/\314\314\314|\211\314\314\314~\1\316\316\316\77"
-  "\236\0\0\0\0\1\317\317\317\20\206\314\314\314~\1\317\317\317;\236\0\0"
-  "\0\0\2\315\315\3153\314\314\314}\210\314\314\314~\2\314\314\314}\314"
-  "\314\3147\245\0\0\0\0\2\321\321\321!\314\314\314x\211\315\315\315\177"
-  "\2\315\315\315H\377\377\377\1\234\0\0\0\0\1\317\317\317\20\206\315\315"
-  "\315\177\1\314\314\314<\235\0\0\0\0\1\315\315\315H\211\315\315\315\177"
-  "\2\313\313\313{\314\314\314(\247\0\0\0\0\2\305\305\305\26\315\315\315"
-  "p\211\313\313\313\200\2\313\313\313X\314\314\314\5\233\0\0\0\0\1\317"
-  "\317\317\20\206\313\313\313\200\1\314\314\314<\233\0\0\0\0\2\277\277"
-  "\277\4\314\314\314U\211\313\313\313\200\2\313\313\313u\310\310\310\34"
-  "\251\0\0\0\0\2\304\304\304\15\313\313\313g\211\314\314\314\201\2\315"
-  "\315\315f\277\277\277\14\232\0\0\0\0\1\317\317\317\20\206\314\314\314"
-  "\201\1\311\311\311=\232\0\0\0\0\2\277\277\277\10\315\315\315`\211\314"
-  "\314\314\201\2\314\314\314m\322\322\322\21\253\0\0\0\0\2\325\325\325"
-  "\6\315\315\315[\211\314\314\314\203\2\314\314\314r\316\316\316\25\231"
-  "\0\0\0\0\1\317\317\317\20\206\314\314\314\203\1\312\312\312>\231\0\0"
-  "\0\0\2\317\317\317\20\314\314\314m\211\314\314\314\203\2\314\314\314"
-  "d\306\306\306\11\255\0\0\0\0\2\200\200\200\2\315\315\315L\211\315\315"
-  "\315\204\2\315\315\315{\321\321\321!\230\0\0\0\0\1\303\303\303\21\206"
-  "\315\315\315\204\1\316\316\316>\230\0\0\0\0\2\316\316\316\32\316\316"
-  "\316w\211\315\315\315\204\2\315\315\315V\277\277\277\4\260\0\0\0\0\2"
-  "\312\312\312:\313\313\313\204\210\313\313\313\205\2\314\314\314\202\312"
-  "\312\3120\227\0\0\0\0\1\303\303\303\21\206\313\313\313\205\1\312\312"
-  "\312\77\227\0\0\0\0\2\313\313\313'\313\313\313\177\211\313\313\313\205"
-  "\2\312\312\312C\0\0\0\1\262\0\0\0\0\2\312\312\312+\314\314\314\201\210"
-  "\314\314\314\206\2\315\315\315\205\316\316\316C\226\0\0\0\0\1\303\303"
-  "\303\21\206\314\314\314\206\1\312\312\312\77\226\0\0\0\0\2\314\314\314"
-  "7\315\315\315\204\210\314\314\314\206\2\313\313\313\204\312\312\3125"
-  "\265\0\0\0\0\2\312\312\312\35\315\315\315{\211\314\314\314\207\2\313"
-  "\313\313T\252\252\252\3\224\0\0\0\0\1\322\322\322\21\206\314\314\314"
-  "\207\1\313\313\313@\224\0\0\0\0\2\377\377\377\1\312\312\312M\211\314"
-  "\314\314\207\2\314\314\314\202\310\310\310*\267\0\0\0\0\2\306\306\306"
-  "\22\314\314\314t\211\315\315\315\211\2\317\317\317d\277\277\277\10\223"
-  "\0\0\0\0\1\322\322\322\21\206\315\315\315\211\1\317\317\317@\223\0\0"
-  "\0\0\2\277\277\277\4\315\315\315[\211\315\315\315\211\2\314\314\314}"
-  "\321\321\321\34\271\0\0\0\0\2\306\306\306\11\314\314\314h\211\313\313"
-  "\313\212\2\314\314\314r\317\317\317\20\222\0\0\0\0\1\322\322\322\21\206"
-  "\313\313\313\212\1\314\314\314A\222\0\0\0\0\2\321\321\321\13\313\313"
-  "\313k\211\313\313\313\212\2\312\312\312t\306\306\306\22\273\0\0\0\0\2"
-  "\377\377\377\3\313\313\313Y\211\314\314\314\213\2\314\314\314}\306\306"
-  "\306\33\221\0\0\0\0\1\322\322\322\21\206\314\314\314\213\1\314\314\314"
-  "A\221\0\0\0\0\2\303\303\303\21\314\314\314t\211\314\314\314\213\2\314"
-  "\314\314i\306\306\306\11\275\0\0\0\0\2\0\0\0\1\314\314\314F\211\314\314"
-  "\314\214\2\315\315\315\205\315\315\315)\220\0\0\0\0\1\306\306\306\22"
-  "\206\314\314\314\214\1\315\315\315B\220\0\0\0\0\2\310\310\310\34\313"
-  "\313\313\177\211\314\314\314\214\2\314\314\314Z\377\377\377\3\300\0\0"
-  "\0\0\2\313\313\3136\315\315\315\212\210\314\314\314\215\2\314\314\314"
-  "\213\312\312\312:\217\0\0\0\0\1\306\306\306\22\206\314\314\314\215\1"
-  "\315\315\315B\217\0\0\0\0\2\316\316\316*\314\314\314\207\211\314\314"
-  "\314\215\2\315\315\315G\0\0\0\1\302\0\0\0\0\2\311\311\311&\312\312\312"
-  "\207\211\313\313\313\217\2\315\315\315Q\377\377\377\1\215\0\0\0\0\1\306"
-  "\306\306\22\206\313\313\313\217\1\316\316\316C\216\0\0\0\0\2\313\313"
-  "\313;\314\314\314\215\210\313\313\313\217\2\314\314\314\214\314\314\314"
-  "7\305\0\0\0\0\2\314\314\314\31\313\313\313\177\211\314\314\314\220\2"
-  "\315\315\315`\314\314\314\5\214\0\0\0\0\1\306\306\306\22\206\314\314"
-  "\314\220\1\313\313\313D\214\0\0\0\0\2\377\377\377\1\312\312\312R\211"
-  "\314\314\314\220\2\314\314\314\210\313\313\313'\307\0\0\0\0\2\310\310"
-  "\310\16\314\314\314t\211\314\314\314\221\2\315\315\315p\321\321\321\13"
-  "\213\0\0\0\0\1\325\325\325\22\206\314\314\314\221\1\316\316\316D\213"
-  "\0\0\0\0\2\314\314\314\5\315\315\315a\211\314\314\314\221\2\314\314\314"
-  "\201\304\304\304\32\311\0\0\0\0\2\325\325\325\6\315\315\315f\211\314"
-  "\314\314\222\2\315\315\315z\325\325\325\22\212\0\0\0\0\1\325\325\325"
-  "\22\206\314\314\314\222\1\313\313\313E\212\0\0\0\0\2\321\321\321\13\315"
-  "\315\315q\211\314\314\314\222\2\314\314\314w\314\314\314\17\313\0\0\0"
-  "\0\2\200\200\200\2\314\314\314U\211\315\315\315\223\2\315\315\315\205"
-  "\316\316\316\37\211\0\0\0\0\1\325\325\325\22\206\315\315\315\223\1\317"
-  "\317\317E\211\0\0\0\0\2\316\316\316\25\314\314\314~\211\315\315\315\223"
-  "\2\314\314\314i\333\333\333\7\316\0\0\0\0\2\314\314\314A\313\313\313"
-  "\224\210\314\314\314\225\2\313\313\313\217\310\310\310.\210\0\0\0\0\1"
-  "\311\311\311\23\206\314\314\314\225\1\314\314\314F\210\0\0\0\0\2\314"
-  "\314\314\36\314\314\314\207\211\314\314\314\225\2\313\313\313Y\377\377"
-  "\377\2\320\0\0\0\0\2\317\317\3170\314\314\314\220\210\314\314\314\226"
-  "\2\315\315\315\224\313\313\313@\207\0\0\0\0\1\311\311\311\23\206\314"
-  "\314\314\226\1\311\311\311G\207\0\0\0\0\2\314\314\314-\314\314\314\220"
-  "\210\314\314\314\226\2\315\315\315\225\314\314\314F\323\0\0\0\0\2\311"
-  "\311\311!\315\315\315\212\211\314\314\314\227\2\315\315\315V\377\377"
-  "\377\1\205\0\0\0\0\1\311\311\311\23\206\314\314\314\227\1\315\315\315"
-  "G\206\0\0\0\0\2\316\316\316\77\315\315\315\225\210\314\314\314\227\2"
-  "\315\315\315\223\315\315\3158\325\0\0\0\0\2\314\314\314\24\315\315\315"
-  "\200\211\315\315\315\230\2\314\314\314h\325\325\325\6\204\0\0\0\0\1\311"
-  "\311\311\23\206\315\315\315\230\1\312\312\312H\204\0\0\0\0\2\377\377"
-  "\377\1\315\315\315V\211\315\315\315\230\2\315\315\315\216\321\321\321"
-  "'\327\0\0\0\0\2\321\321\321\13\314\314\314s\211\313\313\313\231\2\314"
-  "\314\314x\330\330\330\15\203\0\0\0\0\1\311\311\311\23\206\313\313\313"
-  "\231\1\312\312\312H\203\0\0\0\0\2\314\314\314\5\313\313\313g\211\313"
-  "\313\313\231\2\314\314\314\207\316\316\316\32\331\0\0\0\0\2\277\277\277"
-  "\4\314\314\314d\211\314\314\314\233\2\314\314\314\206\312\312\312\30"
-  "\202\0\0\0\0\1\327\327\327\23\206\314\314\314\233\1\313\313\313I\202"
-  "\0\0\0\0\2\304\304\304\15\314\314\314y\211\314\314\314\233\2\314\314"
-  "\314|\314\314\314\17\333\0\0\0\0\2\0\0\0\1\316\316\316N\211\314\314\314"
-  "\234\4\314\314\314\221\311\311\311&\0\0\0\0\314\314\314\24\206\314\314"
-  "\314\234\4\316\316\316I\0\0\0\0\310\310\310\27\314\314\314\207\211\314"
-  "\314\314\234\2\314\314\314n\333\333\333\7\336\0\0\0\0\2\314\314\314<"
-  "\315\315\315\232\210\315\315\315\235\3\315\315\315\231\314\314\3147\314"
-  "\314\314\24\206\315\315\315\235\3\313\313\313J\315\315\315$\316\316\316"
-  "\221\211\315\315\315\235\2\315\315\315\\\200\200\200\2\340\0\0\0\0\2"
-  "\312\312\3120\314\314\314\227\210\313\313\313\236\2\314\314\314\234\315"
-  "\315\315V\206\313\313\313\236\2\313\313\313q\314\314\314\226\211\313"
-  "\313\313\236\2\311\311\311Q\0\0\0\1\342\0\0\0\0\2\320\320\320\33\314"
-  "\314\314\214\230\314\314\314\237\2\314\314\314\232\316\316\3164\345\0"
-  "\0\0\0\2\317\317\317\20\314\314\314\201\226\314\314\314\241\2\315\315"
-  "\315\224\315\315\315$\347\0\0\0\0\2\333\333\333\7\314\314\314r\224\315"
-  "\315\315\242\2\315\315\315\212\310\310\310\27\351\0\0\0\0\2\377\377\377"
-  "\2\311\311\311_\222\313\313\313\243\2\314\314\314}\325\325\325\14\354"
-  "\0\0\0\0\2\315\315\315G\313\313\313\243\217\314\314\314\244\2\314\314"
-  "\314r\325\325\325\6\356\0\0\0\0\2\312\312\3125\314\314\314\237\215\314"
-  "\314\314\245\2\316\316\316^\377\377\377\2\360\0\0\0\0\2\315\315\315$"
-  "\313\313\313\231\212\315\315\315\247\2\314\314\314\246\313\313\313I\363"
-  "\0\0\0\0\2\321\321\321\26\313\313\313\216\210\313\313\313\250\2\313\313"
-  "\313\242\317\317\3175\365\0\0\0\0\2\314\314\314\17\314\314\314\206\206"
-  "\314\314\314\251\2\314\314\314\237\316\316\316*\367\0\0\0\0\1\312\312"
-  "\312\30\206\314\314\314\252\1\315\315\315R\370\0\0\0\0\1\316\316\316"
-  "\25\206\314\314\314\253\1\314\314\314P\370\0\0\0\0\1\305\305\305\26\206"
-  "\313\313\313\255\1\315\315\315Q\370\0\0\0\0\1\305\305\305\26\206\314"
-  "\314\314\256\1\312\312\312R\370\0\0\0\0\1\321\321\321\26\206\314\314"
-  "\314\257\1\315\315\315R\370\0\0\0\0\1\321\321\321\26\206\314\314\314"
-  "\260\1\313\313\313S\370\0\0\0\0\1\321\321\321\26\206\315\315\315\261"
-  "\1\316\316\316S\370\0\0\0\0\1\321\321\321\26\206\314\314\314\263\1\313"
-  "\313\313T\370\0\0\0\0\1\310\310\310\27\206\314\314\314\264\1\314\314"
-  "\314U\370\0\0\0\0\1\310\310\310\27\206\314\314\314\265\1\314\314\314"
-  "U\370\0\0\0\0\1\310\310\310\27\206\315\315\315\266\1\315\315\315V\370"
-  "\0\0\0\0\1\310\310\310\27\206\313\313\313\267\1\312\312\312W\370\0\0"
-  "\0\0\1\323\323\323\27\206\314\314\314\271\1\315\315\315W\370\0\0\0\0"
-  "\1\323\323\323\27\206\314\314\314\272\1\313\313\313X\370\0\0\0\0\1\323"
-  "\323\323\27\206\315\315\315\273\1\316\316\316X\370\0\0\0\0\1\312\312"
-  "\312\30\206\313\313\313\274\1\316\316\316X\370\0\0\0\0\1\312\312\312"
-  "\30\202\314\314\314\275\204\314\314\314\276\1\316\316\316Y\370\0\0\0"
-  "\0\1\312\312\312\30\206\314\314\314\277\1\314\314\314Z\370\0\0\0\0\1"
-  "\312\312\312\30\206\315\315\315\300\1\314\314\314Z\370\0\0\0\0\1\312"
-  "\312\312\30\206\313\313\313\301\1\312\312\312[\370\0\0\0\0\1\312\312"
-  "\312\30\206\314\314\314\302\1\315\315\315[\370\0\0\0\0\1\314\314\314"
-  "\31\206\314\314\314\304\1\315\315\315\\\370\0\0\0\0\1\314\314\314\31"
-  "\206\315\315\315\305\1\313\313\313]\370\0\0\0\0\1\314\314\314\31\206"
-  "\313\313\313\306\1\313\313\313]\370\0\0\0\0\1\314\314\314\31\206\314"
-  "\314\314\307\1\313\313\313^\370\0\0\0\0\1\314\314\314\31\206\314\314"
-  "\314\310\1\313\313\313^\370\0\0\0\0\1\314\314\314\31\206\315\315\315"
-  "\312\1\314\314\314_\370\0\0\0\0\1\314\314\314\31\206\313\313\313\313"
-  "\1\312\312\312`\370\0\0\0\0\1\304\304\304\32\206\314\314\314\314\1\315"
-  "\315\315`\221\0\0\0\0\3\31255C\31077\246\325++\6\240\0\0\0\0\3\325++"
-  "\6\31077\247\31166B\301\0\0\0\0\1\316\316\316\32\206\314\314\314\315"
-  "\1\315\315\315`\220\0\0\0\0\5\30788N\31077\371\31077\377\31077\271\306"
-  "99\11\236\0\0\0\0\5\30699\11\31077\271\31077\377\31077\371\30788N\300"
-  "\0\0\0\0\1\316\316\316\32\206\314\314\314\316\1\315\315\315a\217\0\0"
-  "\0\0\2\31077O\31077\371\203\31077\377\2\31077\271\30699\11\234\0\0\0"
-  "\0\2\30699\11\31077\271\203\31077\377\2\31077\371\31077O\277\0\0\0\0"
-  "\1\316\316\316\32\206\314\314\314\320\1\313\313\313b\216\0\0\0\0\2\311"
-  "66P\31077\371\205\31077\377\2\31077\271\30699\11\232\0\0\0\0\2\30699"
-  "\11\31077\271\205\31077\377\2\31077\371\31166P\276\0\0\0\0\1\316\316"
-  "\316\32\206\314\314\314\321\1\316\316\316b\215\0\0\0\0\2\31166Q\3107"
-  "7\372\207\31077\377\2\31077\271\30699\11\230\0\0\0\0\2\30699\11\3107"
-  "7\271\207\31077\377\2\31077\371\31166P\275\0\0\0\0\1\316\316\316\32\206"
-  "\314\314\314\322\1\313\313\313c\214\0\0\0\0\2\30788R\31077\372\211\310"
-  "77\377\2\31077\271\30699\11\226\0\0\0\0\2\30699\11\31077\272\211\310"
-  "77\377\2\31077\372\31166Q\274\0\0\0\0\1\316\316\316\32\206\314\314\314"
-  "\323\1\316\316\316c\214\0\0\0\0\1\30788\256\213\31077\377\2\31166\262"
-  "\325++\6\224\0\0\0\0\2\325++\6\31166\262\213\31077\377\1\31077\255\274"
-  "\0\0\0\0\1\306\306\306\33\206\314\314\314\324\1\314\314\314d\214\0\0"
-  "\0\0\2\31433\5\30788\256\213\31077\377\2\31077\271\30699\11\222\0\0\0"
-  "\0\2\30699\11\31077\272\213\31077\377\2\30788\256\31433\5\274\0\0\0\0"
-  "\1\306\306\306\33\206\314\314\314\326\1\312\312\312e\215\0\0\0\0\2\314"
-  "33\5\31077\257\213\31077\377\2\31077\271\30699\11\220\0\0\0\0\2\3069"
-  "9\11\31077\272\213\31077\377\2\30788\256\31433\5\275\0\0\0\0\1\320\320"
-  "\320\33\206\314\314\314\327\1\315\315\315e\216\0\0\0\0\2\31433\5\310"
-  "77\257\213\31077\377\2\31077\272\30699\11\216\0\0\0\0\2\30699\11\310"
-  "77\272\213\31077\377\2\30788\256\31433\5\276\0\0\0\0\1\320\320\320\33"
-  "\206\314\314\314\330\1\313\313\313f\217\0\0\0\0\2\31433\5\31077\257\213"
-  "\31077\377\2\31077\272\30699\11\214\0\0\0\0\2\30699\11\31077\272\213"
-  "\31077\377\2\31077\257\31433\5\277\0\0\0\0\1\320\320\320\33\206\314\314"
-  "\314\331\1\315\315\315f\220\0\0\0\0\2\31433\5\31077\257\213\31077\377"
-  "\2\31077\272\30699\11\212\0\0\0\0\2\30699\11\31077\272\213\31077\377"
-  "\2\31077\257\31433\5\300\0\0\0\0\1\320\320\320\33\206\314\314\314\332"
-  "\1\313\313\313g\221\0\0\0\0\2\325++\6\31077\260\213\31077\377\2\3107"
-  "7\272\30699\11\210\0\0\0\0\2\30699\11\31077\272\213\31077\377\2\3107"
-  "7\257\31433\5\301\0\0\0\0\1\310\310\310\34\206\314\314\314\334\1\314"
-  "\314\314h\222\0\0\0\0\2\325++\6\31077\260\213\31077\377\2\31077\272\306"
-  "99\11\206\0\0\0\0\2\30699\11\31077\272\213\31077\377\2\31077\257\325"
-  "++\6\302\0\0\0\0\1\310\310\310\34\206\314\314\314\335\1\314\314\314h"
-  "\223\0\0\0\0\2\325++\6\31077\260\213\31077\377\2\31077\272\30699\11\204"
-  "\0\0\0\0\2\30699\11\31077\272\213\31077\377\2\31077\260\325++\6\303\0"
-  "\0\0\0\1\310\310\310\34\206\314\314\314\336\1\316\316\316h\224\0\0\0"
-  "\0\2\325++\6\31077\261\213\31077\377\2\31077\272\30699\11\202\0\0\0\0"
-  "\2\30699\11\31077\272\213\31077\377\2\31077\260\325++\6\304\0\0\0\0\1"
-  "\310\310\310\34\206\314\314\314\337\1\314\314\314i\225\0\0\0\0\2\325"
-  "++\6\31077\261\213\31077\377\4\31077\272\30699\11\321..\13\31077\301"
-  "\213\31077\377\2\31077\260\325++\6\305\0\0\0\0\1\310\310\310\34\206\314"
-  "\314\314\340\1\314\314\314i\226\0\0\0\0\2\30699\11\31077\272\213\310"
-  "77\377\202\31077\264\213\31077\377\2\31077\272\30699\11\306\0\0\0\0\1"
-  "\321\321\321\34\206\314\314\314\342\1\314\314\314j\227\0\0\0\0\2\325"
-  "++\6\31077\261\226\31077\377\2\31077\261\325++\6\307\0\0\0\0\1\321\321"
-  "\321\34\206\314\314\314\343\1\315\315\315k\230\0\0\0\0\2\325++\6\311"
-  "66\262\224\31077\377\2\31077\261\325++\6\310\0\0\0\0\1\312\312\312\35"
-  "\206\314\314\314\344\1\315\315\315k\231\0\0\0\0\2\325++\6\31166\262\222"
-  "\31077\377\2\31077\261\325++\6\311\0\0\0\0\1\312\312\312\35\206\314\314"
-  "\314\345\1\313\313\313l\232\0\0\0\0\2\325++\6\31166\262\220\31077\377"
-  "\2\31166\262\325++\6\312\0\0\0\0\1\312\312\312\35\206\314\314\314\346"
-  "\1\315\315\315l\233\0\0\0\0\2\325++\6\30788\263\216\31077\377\2\3116"
-  "6\262\325++\6\313\0\0\0\0\1\312\312\312\35\206\314\314\314\350\1\316"
-  "\316\316m\234\0\0\0\0\2\325++\6\30788\263\214\31077\377\2\30788\263\325"
-  "++\6\314\0\0\0\0\1\312\312\312\35\206\314\314\314\351\1\314\314\314n"
-  "\234\0\0\0\0\2\325++\6\31077\261\214\31077\377\2\31077\261\325++\6\314"
-  "\0\0\0\0\1\312\312\312\35\206\314\314\314\352\1\314\314\314n\233\0\0"
-  "\0\0\2\30699\11\31077\271\216\31077\377\2\31077\271\30699\11\313\0\0"
-  "\0\0\1\323\323\323\35\206\314\314\314\353\1\312\312\312o\232\0\0\0\0"
-  "\2\30699\11\31077\271\220\31077\377\2\31077\271\30699\11\312\0\0\0\0"
-  "\1\314\314\314\36\206\314\314\314\354\1\314\314\314o\231\0\0\0\0\2\306"
-  "99\11\31077\271\222\31077\377\2\31077\271\30699\11\311\0\0\0\0\1\314"
-  "\314\314\36\206\314\314\314\356\1\313\313\313p\230\0\0\0\0\2\30699\11"
-  "\31077\271\224\31077\377\2\31077\271\30699\11\310\0\0\0\0\1\314\314\314"
-  "\36\206\314\314\314\357\1\315\315\315p\227\0\0\0\0\2\30699\11\31077\272"
-  "\226\31077\377\2\31077\271\30699\11\307\0\0\0\0\1\314\314\314\36\206"
-  "\314\314\314\360\1\313\313\313q\226\0\0\0\0\2\325++\6\31166\262\213\310"
-  "77\377\202\31077\264\213\31077\377\2\31166\262\325++\6\306\0\0\0\0\1"
-  "\314\314\314\36\206\314\314\314\361\1\315\315\315q\225\0\0\0\0\2\306"
-  "99\11\31077\272\213\31077\377\1\30788\256\202\31433\5\1\30788\256\213"
-  "\31077\377\2\31077\271\30699\11\305\0\0\0\0\1\314\314\314\36\206\314"
-  "\314\314\362\1\314\314\314r\224\0\0\0\0\2\30699\11\31077\272\213\310"
-  "77\377\2\30788\256\31433\5\202\0\0\0\0\2\31433\5\31077\257\213\31077"
-  "\377\2\31077\271\30699\11\304\0\0\0\0\1\305\305\305\37\206\314\314\314"
-  "\364\1\314\314\314s\223\0\0\0\0\2\30699\11\31077\272\213\31077\377\2"
-  "\30788\256\31433\5\204\0\0\0\0\2\31433\5\31077\257\213\31077\377\2\310"
-  "77\272\30699\11\303\0\0\0\0\1\316\316\316\37\206\314\314\314\365\1\314"
-  "\314\314s\222\0\0\0\0\2\30699\11\31077\272\213\31077\377\2\31077\257"
-  "\31433\5\206\0\0\0\0\2\31433\5\31077\257\213\31077\377\2\31077\272\306"
-  "99\11\302\0\0\0\0\1\316\316\316\37\206\314\314\314\366\1\314\314\314"
-  "t\221\0\0\0\0\2\30699\11\31077\272\213\31077\377\2\31077\257\31433\5"
-  "\210\0\0\0\0\2\31433\5\31077\257\213\31077\377\2\31077\272\30699\11\301"
-  "\0\0\0\0\1\316\316\316\37\206\314\314\314\367\1\314\314\314t\220\0\0"
-  "\0\0\2\30699\11\31077\272\213\31077\377\2\31077\257\31433\5\212\0\0\0"
-  "\0\2\325++\6\31077\260\213\31077\377\2\31077\272\30699\11\300\0\0\0\0"
-  "\1\316\316\316\37\206\314\314\314\370\1\313\313\313u\217\0\0\0\0\2\306"
-  "99\11\31077\272\213\31077\377\2\31077\257\325++\6\214\0\0\0\0\2\325+"
-  "+\6\31077\260\213\31077\377\2\31077\272\30699\11\277\0\0\0\0\1\316\316"
-  "\316\37\206\314\314\314\372\1\313\313\313v\216\0\0\0\0\2\30699\11\310"
-  "77\272\213\31077\377\2\31077\260\325++\6\216\0\0\0\0\2\325++\6\31077"
-  "\260\213\31077\377\2\31077\272\30699\11\276\0\0\0\0\1\316\316\316\37"
-  "\206\314\314\314\373\1\315\315\315v\215\0\0\0\0\2\30699\11\31077\272"
-  "\213\31077\377\2\31077\260\325++\6\220\0\0\0\0\2\325++\6\31077\261\213"
-  "\31077\377\2\31077\272\30699\11\275\0\0\0\0\1\307\307\307\40\206\314"
-  "\314\314\374\1\314\314\314w\214\0\0\0\0\2\321..\13\31077\301\213\310"
-  "77\377\2\31077\260\325++\6\222\0\0\0\0\2\325++\6\31077\261\213\31077"
-  "\377\2\31077\272\30699\11\274\0\0\0\0\1\307\307\307\40\206\314\314\314"
-  "\375\1\314\314\314w\214\0\0\0\0\1\30788\256\213\31077\377\2\31077\272"
-  "\30699\11\224\0\0\0\0\2\30699\11\31077\272\213\31077\377\1\31077\255"
-  "\274\0\0\0\0\1\307\307\307\40\206\314\314\314\376\1\314\314\314x\214"
-  "\0\0\0\0\2\31077E\31077\366\211\31077\377\2\31077\261\325++\6\226\0\0"
-  "\0\0\2\325++\6\31077\261\211\31077\377\2\31077\366\30788D\274\0\0\0\0"
-  "\1\325\325\325\6\206\315\315\3153\1\312\312\312\30\215\0\0\0\0\2\310"
-  "77E\31077\366\207\31077\377\2\31077\261\325++\6\230\0\0\0\0\2\325++\6"
-  "\31166\262\207\31077\377\2\31077\366\31077E\323\0\0\0\0\2\31077E\310"
-  "77\366\205\31077\377\2\31077\261\325++\6\232\0\0\0\0\2\325++\6\31166"
-  "\262\205\31077\377\2\31077\366\31077E\325\0\0\0\0\2\31077E\31077\366"
-  "\203\31077\377\2\31166\262\325++\6\234\0\0\0\0\2\325++\6\31166\262\203"
-  "\31077\377\2\31077\366\31077E\327\0\0\0\0\5\31077F\31077\367\31077\377"
-  "\31166\262\325++\6\236\0\0\0\0\5\325++\6\30788\263\31077\377\31077\366"
-  "\31077E\331\0\0\0\0\3\30788N\31166\267\31433\12\240\0\0\0\0\3\31433\12"
-  "\31077\270\30788N\205\0\0\0\0",
-};
-
-
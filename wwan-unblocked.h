@@ -1,264 +0,0 @@
-/* GdkPixbuf RGBA C-Source image dump 1-byte-run-length-encoded */
-
-static const GdkPixdata wwan_unblocked_inline = {
-  0x47646b50, /* Pixbuf magic: 'GdkP' */
-  24 + 5593, /* header length + pixel_data length */
-  0x2010002, /* pixdata_type */
-  512, /* rowstride */
-  128, /* width */
-  128, /* height */
-  /* pixel_data: */
-  "\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0"
-  "\0\0\216\0\0\0\0\1\252\252\252\3\346\314\314\314\17\1\316\316\316\25"
-  "\207\310\310\310\27\1\325\325\325\6\221\0\0\0\0\1\313\313\3136\354\314"
-  "\314\314t\1\317\317\317:\223\0\0\0\0\2\314\314\314-\316\316\316s\350"
-  "\315\315\315u\2\314\314\314t\321\321\3212\225\0\0\0\0\2\306\306\306$"
-  "\313\313\313q\210\313\313\313v\336\314\314\314w\2\314\314\314s\311\311"
-  "\311&\227\0\0\0\0\2\312\312\312\35\313\313\313p\344\314\314\314x\2\315"
-  "\315\315q\311\311\311!\231\0\0\0\0\2\311\311\311\23\314\314\314i\211"
-  "\314\314\314y\2\314\314\314x\312\312\312H\242\314\314\314A\1\312\312"
-  "\312H\206\314\314\314y\1\315\315\315[\242\314\314\314A\2\314\314\314"
-  "F\314\314\314w\211\314\314\314y\2\313\313\313l\305\305\305\26\233\0\0"
-  "\0\0\2\337\337\337\10\315\315\315\\\211\315\315\315z\2\316\316\316i\325"
-  "\325\325\22\241\0\0\0\0\1\314\314\314\17\206\315\315\315z\1\316\316\316"
-  "9\241\0\0\0\0\2\333\333\333\16\315\315\315e\211\315\315\315z\2\315\315"
-  "\315a\321\321\321\13\235\0\0\0\0\2\252\252\252\3\313\313\313O\211\313"
-  "\313\313{\2\314\314\314r\312\312\312\35\240\0\0\0\0\1\314\314\314\17"
-  "\206\313\313\313{\1\312\312\312:\240\0\0\0\0\2\312\312\312\30\312\312"
-  "\312o\211\313\313\313{\2\314\314\314U\314\314\314\5\240\0\0\0\0\1\312"
-  "\312\312\77\211\314\314\314}\2\313\313\313z\312\312\312+\237\0\0\0\0"
-  "\1\317\317\317\20\206\314\314\314}\1\313\313\313;\237\0\0\0\0\2\310\310"
-  "\310%\314\314\314w\211\314\314\314}\2\315\315\315H\377\377\377\1\242"
-  "\0\0\0\0\2\316\316\316/\314\314\314|\211\314\314\314~\1\316\316\316\77"
-  "\236\0\0\0\0\1\317\317\317\20\206\314\314\314~\1\317\317\317;\236\0\0"
-  "\0\0\2\315\315\3153\314\314\314}\210\314\314\314~\2\314\314\314}\314"
-  "\314\3147\245\0\0\0\0\2\321\321\321!\314\314\314x\211\315\315\315\177"
-  "\2\315\315\315H\377\377\377\1\234\0\0\0\0\1\317\317\317\20\206\315\315"
-  "\315\177\1\314\314\314<\235\0\0\0\0\1\315\315\315H\211\315\315\315\177"
-  "\2\313\313\313{\314\314\314(\247\0\0\0\0\2\305\305\305\26\315\315\315"
-  "p\211\313\313\313\200\2\313\313\313X\314\314\314\5\233\0\0\0\0\1\317"
-  "\317\317\20\206\313\313\313\200\1\314\314\314<\233\0\0\0\0\2\277\277"
-  "\277\4\314\314\314U\211\313\313\313\200\2\313\313\313u\310\310\310\34"
-  "\251\0\0\0\0\2\304\304\304\15\313\313\313g\211\314\314\314\201\2\315"
-  "\315\315f\277\277\277\14\232\0\0\0\0\1\317\317\317\20\206\314\314\314"
-  "\201\1\311\311\311=\232\0\0\0\0\2\277\277\277\10\315\315\315`\211\314"
-  "\314\314\201\2\314\314\314m\322\322\322\21\253\0\0\0\0\2\325\325\325"
-  "\6\315\315\315[\211\314\314\314\203\2\314\314\314r\316\316\316\25\231"
-  "\0\0\0\0\1\317\317\317\20\206\314\314\314\203\1\312\312\312>\231\0\0"
-  "\0\0\2\317\317\317\20\314\314\314m\211\314\314\314\203\2\314\314\314"
-  "d\306\306\306\11\255\0\0\0\0\2\200\200\200\2\315\315\315L\211\315\315"
-  "\315\204\2\315\315\315{\321\321\321!\230\0\0\0\0\1\303\303\303\21\206"
-  "\315\315\315\204\1\316\316\316>\230\0\0\0\0\2\316\316\316\32\316\316"
-  "\316w\211\315\315\315\204\2\315\315\315V\277\277\277\4\260\0\0\0\0\2"
-  "\312\312\312:\313\313\313\204\210\313\313\313\205\2\314\314\314\202\312"
-  "\312\3120\227\0\0\0\0\1\303\303\303\21\206\313\313\313\205\1\312\312"
-  "\312\77\227\0\0\0\0\2\313\313\313'\313\313\313\177\211\313\313\313\205"
-  "\2\312\312\312C\0\0\0\1\262\0\0\0\0\2\312\312\312+\314\314\314\201\210"
-  "\314\314\314\206\2\315\315\315\205\316\316\316C\226\0\0\0\0\1\303\303"
-  "\303\21\206\314\314\314\206\1\312\312\312\77\226\0\0\0\0\2\314\314\314"
-  "7\315\315\315\204\210\314\314\314\206\2\313\313\313\204\312\312\3125"
-  "\265\0\0\0\0\2\312\312\312\35\315\315\315{\211\314\314\314\207\2\313"
-  "\313\313T\252\252\252\3\224\0\0\0\0\1\322\322\322\21\206\314\314\314"
-  "\207\1\313\313\313@\224\0\0\0\0\2\377\377\377\1\312\312\312M\211\314"
-  "\314\314\207\2\314\314\314\202\310\310\310*\267\0\0\0\0\2\306\306\306"
-  "\22\314\314\314t\211\315\315\315\211\2\317\317\317d\277\277\277\10\223"
-  "\0\0\0\0\1\322\322\322\21\206\315\315\315\211\1\317\317\317@\223\0\0"
-  "\0\0\2\277\277\277\4\315\315\315[\211\315\315\315\211\2\314\314\314}"
-  "\321\321\321\34\271\0\0\0\0\2\306\306\306\11\314\314\314h\211\313\313"
-  "\313\212\2\314\314\314r\317\317\317\20\222\0\0\0\0\1\322\322\322\21\206"
-  "\313\313\313\212\1\314\314\314A\222\0\0\0\0\2\321\321\321\13\313\313"
-  "\313k\211\313\313\313\212\2\312\312\312t\306\306\306\22\273\0\0\0\0\2"
-  "\377\377\377\3\313\313\313Y\211\314\314\314\213\2\314\314\314}\306\306"
-  "\306\33\221\0\0\0\0\1\322\322\322\21\206\314\314\314\213\1\314\314\314"
-  "A\221\0\0\0\0\2\303\303\303\21\314\314\314t\211\314\314\314\213\2\314"
-  "\314\314i\306\306\306\11\275\0\0\0\0\2\0\0\0\1\314\314\314F\211\314\314"
-  "\314\214\2\315\315\315\205\315\315\315)\220\0\0\0\0\1\306\306\306\22"
-  "\206\314\314\314\214\1\315\315\315B\220\0\0\0\0\2\310\310\310\34\313"
-  "\313\313\177\211\314\314\314\214\2\314\314\314Z\377\377\377\3\300\0\0"
-  "\0\0\2\313\313\3136\315\315\315\212\210\314\314\314\215\2\314\314\314"
-  "\213\312\312\312:\217\0\0\0\0\1\306\306\306\22\206\314\314\314\215\1"
-  "\315\315\315B\217\0\0\0\0\2\316\316\316*\314\314\314\207\211\314\314"
-  "\314\215\2\315\315\315G\0\0\0\1\302\0\0\0\0\2\311\311\311&\312\312\312"
-  "\207\211\313\313\313\217\2\315\315\315Q\377\377\377\1\215\0\0\0\0\1\306"
-  "\306\306\22\206\313\313\313\217\1\316\316\316C\216\0\0\0\0\2\313\313"
-  "\313;\314\314\314\215\210\313\313\313\217\2\314\314\314\214\314\314\314"
-  "7\305\0\0\0\0\2\314\314\314\31\313\313\313\177\211\314\314\314\220\2"
-  "\315\315\315`\314\314\314\5\214\0\0\0\0\1\306\306\306\22\206\314\314"
-  "\314\220\1\313\313\313D\214\0\0\0\0\2\377\377\377\1\312\312\312R\211"
-  "\314\314\314\220\2\314\314\314\210\313\313\313'\307\0\0\0\0\2\310\310"
-  "\310\16\314\314\314t\211\314\314\314\221\2\315\315\315p\321\321\321\13"
-  "\213\0\0\0\0\1\325\325\325\22\206\314\314\314\221\1\316\316\316D\213"
-  "\0\0\0\0\2\314\314\314\5\315\315\315a\211\314\314\314\221\2\314\314\314"
-  "\201\304\304\304\32\311\0\0\0\0\2\325\325\325\6\315\315\315f\211\314"
-  "\314\314\222\2\315\315\315z\325\325\325\22\212\0\0\0\0\1\325\325\325"
-  "\22\206\314\314\314\222\1\313\313\313E\212\0\0\0\0\2\321\321\321\13\315"
-  "\315\315q\211\314\314\314\222\2\314\314\314w\314\314\314\17\313\0\0\0"
-  "\0\2\200\200\200\2\314\314\314U\211\315\315\315\223\2\315\315\315\205"
-  "\316\316\316\37\211\0\0\0\0\1\325\325\325\22\206\315\315\315\223\1\317"
-  "\317\317E\211\0\0\0\0\2\316\316\316\25\314\314\314~\211\315\315\315\223"
-  "\2\314\314\314i\333\333\333\7\316\0\0\0\0\2\314\314\314A\313\313\313"
-  "\224\210\314\314\314\225\2\313\313\313\217\310\310\310.\210\0\0\0\0\1"
-  "\311\311\311\23\206\314\314\314\225\1\314\314\314F\210\0\0\0\0\2\314"
-  "\314\314\36\314\314\314\207\211\314\314\314\225\2\313\313\313Y\377\377"
-  "\377\2\320\0\0\0\0\2\317\317\3170\314\314\314\220\210\314\314\314\226"
-  "\2\315\315\315\224\313\313\313@\207\0\0\0\0\1\311\311\311\23\206\314"
-  "\314\314\226\1\311\311\311G\207\0\0\0\0\2\314\314\314-\314\314\314\220"
-  "\210\314\314\314\226\2\315\315\315\225\314\314\314F\323\0\0\0\0\2\311"
-  "\311\311!\315\315\315\212\211\314\314\314\227\2\315\315\315V\377\377"
-  "\377\1\205\0\0\0\0\1\311\311\311\23\206\314\314\314\227\1\315\315\315"
-  "G\206\0\0\0\0\2\316\316\316\77\315\315\315\225\210\314\314\314\227\2"
-  "\315\315\315\223\315\315\3158\325\0\0\0\0\2\314\314\314\24\315\315\315"
-  "\200\211\315\315\315\230\2\314\314\314h\325\325\325\6\204\0\0\0\0\1\311"
-  "\311\311\23\206\315\315\315\230\1\312\312\312H\204\0\0\0\0\2\377\377"
-  "\377\1\315\315\315V\211\315\315\315\230\2\315\315\315\216\321\321\321"
-  "'\327\0\0\0\0\2\321\321\321\13\314\314\314s\211\313\313\313\231\2\314"
-  "\314\314x\330\330\330\15\203\0\0\0\0\1\311\311\311\23\206\313\313\313"
-  "\231\1\312\312\312H\203\0\0\0\0\2\314\314\314\5\313\313\313g\211\313"
-  "\313\313\231\2\314\314\314\207\316\316\316\32\331\0\0\0\0\2\277\277\277"
-  "\4\314\314\314d\211\314\314\314\233\2\314\314\314\206\312\312\312\30"
-  "\202\0\0\0\0\1\327\327\327\23\206\314\314\314\233\1\313\313\313I\202"
-  "\0\0\0\0\2\304\304\304\15\314\314\314y\211\314\314\314\233\2\314\314"
-  "\314|\314\314\314\17\333\0\0\0\0\2\0\0\0\1\316\316\316N\211\314\314\314"
-  "\234\4\314\314\314\221\311\311\311&\0\0\0\0\314\314\314\24\206\314\314"
-  "\314\234\4\316\316\316I\0\0\0\0\310\310\310\27\314\314\314\207\211\314"
-  "\314\314\234\2\314\314\314n\333\333\333\7\336\0\0\0\0\2\314\314\314<"
-  "\315\315\315\232\210\315\315\315\235\3\315\315\315\231\314\314\3147\314"
-  "\314\314\24\206\315\315\315\235\3\313\313\313J\315\315\315$\316\316\316"
-  "\221\211\315\315\315\235\2\315\315\315\\\200\200\200\2\340\0\0\0\0\2"
-  "\312\312\3120\314\314\314\227\210\313\313\313\236\2\314\314\314\234\315"
-  "\315\315V\206\313\313\313\236\2\313\313\313q\314\314\314\226\211\313"
-  "\313\313\236\2\311\311\311Q\0\0\0\1\342\0\0\0\0\2\320\320\320\33\314"
-  "\314\314\214\230\314\314\314\237\2\314\314\314\232\316\316\3164\345\0"
-  "\0\0\0\2\317\317\317\20\314\314\314\201\226\314\314\314\241\2\315\315"
-  "\315\224\315\315\315$\347\0\0\0\0\2\333\333\333\7\314\314\314r\224\315"
-  "\315\315\242\2\315\315\315\212\310\310\310\27\351\0\0\0\0\2\377\377\377"
-  "\2\311\311\311_\222\313\313\313\243\2\314\314\314}\325\325\325\14\354"
-  "\0\0\0\0\2\315\315\315G\313\313\313\243\217\314\314\314\244\2\314\314"
-  "\314r\325\325\325\6\356\0\0\0\0\2\312\312\3125\314\314\314\237\215\314"
-  "\314\314\245\2\316\316\316^\377\377\377\2\360\0\0\0\0\2\315\315\315$"
-  "\313\313\313\231\212\315\315\315\247\2\314\314\314\246\313\313\313I\363"
-  "\0\0\0\0\2\321\321\321\26\313\313\313\216\210\313\313\313\250\2\313\313"
-  "\313\242\317\317\3175\365\0\0\0\0\2\314\314\314\17\314\314\314\206\206"
-  "\314\314\314\251\2\314\314\314\237\316\316\316*\367\0\0\0\0\1\312\312"
-  "\312\30\206\314\314\314\252\1\315\315\315R\370\0\0\0\0\1\316\316\316"
-  "\25\206\314\314\314\253\1\314\314\314P\370\0\0\0\0\1\305\305\305\26\206"
-  "\313\313\313\255\1\315\315\315Q\370\0\0\0\0\1\305\305\305\26\206\314"
-  "\314\314\256\1\312\312\312R\370\0\0\0\0\1\321\321\321\26\206\314\314"
-  "\314\257\1\315\315\315R\370\0\0\0\0\1\321\321\321\26\206\314\314\314"
-  "\260\1\313\313\313S\370\0\0\0\0\1\321\321\321\26\206\315\315\315\261"
-  "\1\316\316\316S\370\0\0\0\0\1\321\321\321\26\206\314\314\314\263\1\313"
-  "\313\313T\370\0\0\0\0\1\310\310\310\27\206\314\314\314\264\1\314\314"
-  "\314U\370\0\0\0\0\1\310\310\310\27\206\314\314\314\265\1\314\314\314"
-  "U\370\0\0\0\0\1\310\310\310\27\206\315\315\315\266\1\315\315\315V\370"
-  "\0\0\0\0\1\310\310\310\27\206\313\313\313\267\1\312\312\312W\370\0\0"
-  "\0\0\1\323\323\323\27\206\314\314\314\271\1\315\315\315W\370\0\0\0\0"
-  "\1\323\323\323\27\206\314\314\314\272\1\313\313\313X\370\0\0\0\0\1\323"
-  "\323\323\27\206\315\315\315\273\1\316\316\316X\370\0\0\0\0\1\312\312"
-  "\312\30\206\313\313\313\274\1\316\316\316X\370\0\0\0\0\1\312\312\312"
-  "\30\202\314\314\314\275\204\314\314\314\276\1\316\316\316Y\370\0\0\0"
-  "\0\1\312\312\312\30\206\314\314\314\277\1\314\314\314Z\370\0\0\0\0\1"
-  "\312\312\312\30\206\315\315\315\300\1\314\314\314Z\370\0\0\0\0\1\312"
-  "\312\312\30\206\313\313\313\301\1\312\312\312[\370\0\0\0\0\1\312\312"
-  "\312\30\206\314\314\314\302\1\315\315\315[\370\0\0\0\0\1\314\314\314"
-  "\31\206\314\314\314\304\1\315\315\315\\\370\0\0\0\0\1\314\314\314\31"
-  "\206\315\315\315\305\1\313\313\313]\370\0\0\0\0\1\314\314\314\31\206"
-  "\313\313\313\306\1\313\313\313]\370\0\0\0\0\1\314\314\314\31\206\314"
-  "\314\314\307\1\313\313\313^\370\0\0\0\0\1\314\314\314\31\206\314\314"
-  "\314\310\1\313\313\313^\370\0\0\0\0\1\314\314\314\31\206\315\315\315"
-  "\312\1\314\314\314_\370\0\0\0\0\1\314\314\314\31\206\313\313\313\313"
-  "\1\312\312\312`\370\0\0\0\0\1\304\304\304\32\206\314\314\314\314\1\315"
-  "\315\315`\273\0\0\0\0\1\0\200\0\"\274\0\0\0\0\1\316\316\316\32\206\314"
-  "\314\314\315\1\315\315\315`\272\0\0\0\0\2\0\200\0""6\0\202\0""9\274\0"
-  "\0\0\0\1\316\316\316\32\206\314\314\314\316\1\315\315\315a\271\0\0\0"
-  "\0\2\0\200\0\26\0\200\0\243\275\0\0\0\0\1\316\316\316\32\206\314\314"
-  "\314\320\1\313\313\313b\270\0\0\0\0\3\0\200\0\4\0\200\0\276\0\200\0@"
-  "\275\0\0\0\0\1\316\316\316\32\206\314\314\314\321\1\316\316\316b\270"
-  "\0\0\0\0\2\0\200\0\214\0\200\0\300\276\0\0\0\0\1\316\316\316\32\206\314"
-  "\314\314\322\1\313\313\313c\267\0\0\0\0\3\0\201\0W\0\200\0\377\0\201"
-  "\0A\276\0\0\0\0\1\316\316\316\32\206\314\314\314\323\1\316\316\316c\266"
-  "\0\0\0\0\3\0\200\0,\0\200\0\364\0\200\0\300\277\0\0\0\0\1\306\306\306"
-  "\33\206\314\314\314\324\1\314\314\314d\265\0\0\0\0\4\0\200\0\20\0\200"
-  "\0\333\0\200\0\377\0\201\0A\277\0\0\0\0\1\306\306\306\33\206\314\314"
-  "\314\326\1\312\312\312e\264\0\0\0\0\4\0\200\0\2\0\200\0\263\0\200\0\377"
-  "\0\200\0\300\300\0\0\0\0\1\320\320\320\33\206\314\314\314\327\1\315\315"
-  "\315e\264\0\0\0\0\1\0\201\0\177\202\0\200\0\377\1\0\200\0B\300\0\0\0"
-  "\0\1\320\320\320\33\206\314\314\314\330\1\313\313\313f\263\0\0\0\0\4"
-  "\0\201\0K\0\200\0\375\0\200\0\377\0\200\0\300\301\0\0\0\0\1\320\320\320"
-  "\33\206\314\314\314\331\1\315\315\315f\262\0\0\0\0\2\0\200\0$\0\200\0"
-  "\357\202\0\200\0\377\1\0\200\0B\301\0\0\0\0\1\320\320\320\33\206\314"
-  "\314\314\332\1\313\313\313g\261\0\0\0\0\2\0\213\0\13\0\200\0\322\202"
-  "\0\200\0\377\1\0\200\0\301\302\0\0\0\0\1\310\310\310\34\206\314\314\314"
-  "\334\1\314\314\314h\261\0\0\0\0\1\0\200\0\247\203\0\200\0\377\1\0\201"
-  "\0C\302\0\0\0\0\1\310\310\310\34\206\314\314\314\335\1\314\314\314h\260"
-  "\0\0\0\0\1\0\201\0q\203\0\200\0\377\1\0\200\0\301\303\0\0\0\0\1\310\310"
-  "\310\34\206\314\314\314\336\1\316\316\316h\257\0\0\0\0\2\0\200\0@\0\200"
-  "\0\373\203\0\200\0\377\1\0\200\0D\303\0\0\0\0\1\310\310\310\34\206\314"
-  "\314\314\337\1\314\314\314i\256\0\0\0\0\2\0\200\0\34\0\200\0\351\203"
-  "\0\200\0\377\1\0\200\0\301\304\0\0\0\0\1\310\310\310\34\206\314\314\314"
-  "\340\1\314\314\314i\255\0\0\0\0\2\0\222\0\7\0\200\0\310\204\0\200\0\377"
-  "\1\0\200\0D\304\0\0\0\0\1\321\321\321\34\206\314\314\314\342\1\314\314"
-  "\314j\255\0\0\0\0\1\0\200\0\230\204\0\200\0\377\1\0\200\0\302\305\0\0"
-  "\0\0\1\321\321\321\34\206\314\314\314\343\1\315\315\315k\254\0\0\0\0"
-  "\1\0\200\0d\205\0\200\0\377\1\0\201\0E\305\0\0\0\0\1\312\312\312\35\206"
-  "\314\314\314\344\1\315\315\315k\253\0\0\0\0\2\0\202\0""5\0\200\0\370"
-  "\204\0\200\0\377\1\0\200\0\302\306\0\0\0\0\1\312\312\312\35\206\314\314"
-  "\314\345\1\313\313\313l\252\0\0\0\0\2\0\206\0\25\0\200\0\342\205\0\200"
-  "\0\377\1\0\201\0E\306\0\0\0\0\1\312\312\312\35\206\314\314\314\346\1"
-  "\315\315\315l\251\0\0\0\0\2\0\200\0\4\0\200\0\276\205\0\200\0\377\1\0"
-  "\200\0\302\307\0\0\0\0\1\312\312\312\35\206\314\314\314\350\1\316\316"
-  "\316m\214\0\0\0\0\1\0\200\0\6\234\0\0\0\0\1\0\200\0\203\206\0\200\0\377"
-  "\1\0\200\0J\307\0\0\0\0\1\312\312\312\35\206\314\314\314\351\1\314\314"
-  "\314n\214\0\0\0\0\3\0\200\0""8\0\201\0\177\0\200\0\16\231\0\0\0\0\2\0"
-  "\200\0V\0\200\0\376\205\0\200\0\377\1\0\200\0\302\310\0\0\0\0\1\312\312"
-  "\312\35\206\314\314\314\352\1\314\314\314n\215\0\0\0\0\4\0\200\0F\0\200"
-  "\0\343\0\201\0w\0\200\0\10\226\0\0\0\0\2\0\200\0,\0\200\0\363\206\0\200"
-  "\0\377\1\0\200\0F\310\0\0\0\0\1\323\323\323\35\206\314\314\314\353\1"
-  "\312\312\312o\216\0\0\0\0\5\0\200\0F\0\200\0\367\0\200\0\342\0\200\0"
-  "f\0\200\0\4\223\0\0\0\0\2\0\200\0\20\0\200\0\332\206\0\200\0\377\1\0"
-  "\200\0\303\311\0\0\0\0\1\314\314\314\36\206\314\314\314\354\1\314\314"
-  "\314o\217\0\0\0\0\6\0\200\0H\0\200\0\367\0\200\0\377\0\200\0\327\0\201"
-  "\0U\0\377\0\1\220\0\0\0\0\2\0\200\0\2\0\200\0\262\207\0\200\0\377\1\0"
-  "\201\0G\311\0\0\0\0\1\314\314\314\36\206\314\314\314\356\1\313\313\313"
-  "p\220\0\0\0\0\2\0\200\0H\0\200\0\370\202\0\200\0\377\2\0\200\0\322\0"
-  "\201\0U\217\0\0\0\0\1\0\200\0|\207\0\200\0\377\1\0\200\0\303\312\0\0"
-  "\0\0\1\314\314\314\36\206\314\314\314\357\1\315\315\315p\221\0\0\0\0"
-  "\2\0\201\0I\0\200\0\370\203\0\200\0\377\2\0\200\0\305\0\200\0@\214\0"
-  "\0\0\0\2\0\200\0J\0\200\0\375\207\0\200\0\377\1\0\201\0G\312\0\0\0\0"
-  "\1\314\314\314\36\206\314\314\314\360\1\313\313\313q\222\0\0\0\0\2\0"
-  "\200\0J\0\200\0\370\204\0\200\0\377\2\0\200\0\273\0\200\0""2\211\0\0"
-  "\0\0\2\0\203\0#\0\200\0\356\207\0\200\0\377\1\0\200\0\303\313\0\0\0\0"
-  "\1\314\314\314\36\206\314\314\314\361\1\315\315\315q\223\0\0\0\0\2\0"
-  "\200\0R\0\200\0\372\204\0\200\0\377\3\0\200\0\376\0\200\0\252\0\200\0"
-  "&\206\0\0\0\0\2\0\200\0\12\0\200\0\321\210\0\200\0\377\1\0\200\0H\313"
-  "\0\0\0\0\1\314\314\314\36\206\314\314\314\362\1\314\314\314r\224\0\0"
-  "\0\0\2\0\200\0R\0\200\0\372\205\0\200\0\377\3\0\200\0\375\0\200\0\252"
-  "\0\203\0!\204\0\0\0\0\1\0\200\0\245\210\0\200\0\377\1\0\200\0\303\314"
-  "\0\0\0\0\1\305\305\305\37\206\314\314\314\364\1\314\314\314s\225\0\0"
-  "\0\0\2\0\201\0]\0\200\0\374\206\0\200\0\377\5\0\200\0\364\0\200\0\205"
-  "\0\200\0\20\0\0\0\0\0\201\0g\211\0\200\0\377\1\0\200\0L\314\0\0\0\0\1"
-  "\316\316\316\37\206\314\314\314\365\1\314\314\314s\226\0\0\0\0\2\0\201"
-  "\0_\0\200\0\375\207\0\200\0\377\3\0\200\0\356\0\200\0\215\0\200\0\370"
-  "\210\0\200\0\377\2\0\200\0\314\0\377\0\1\314\0\0\0\0\1\316\316\316\37"
-  "\206\314\314\314\366\1\314\314\314t\227\0\0\0\0\2\0\201\0U\0\200\0\373"
-  "\221\0\200\0\377\1\0\201\0I\315\0\0\0\0\1\316\316\316\37\206\314\314"
-  "\314\367\1\314\314\314t\230\0\0\0\0\2\0\200\0V\0\200\0\373\217\0\200"
-  "\0\377\1\0\200\0\310\316\0\0\0\0\1\316\316\316\37\206\314\314\314\370"
-  "\1\313\313\313u\231\0\0\0\0\2\0\201\0W\0\200\0\374\216\0\200\0\377\1"
-  "\0\200\0J\316\0\0\0\0\1\316\316\316\37\206\314\314\314\372\1\313\313"
-  "\313v\232\0\0\0\0\2\0\201\0_\0\200\0\375\214\0\200\0\377\1\0\200\0\310"
-  "\317\0\0\0\0\1\316\316\316\37\206\314\314\314\373\1\315\315\315v\233"
-  "\0\0\0\0\2\0\200\0`\0\200\0\375\213\0\200\0\377\1\0\200\0J\317\0\0\0"
-  "\0\1\307\307\307\40\206\314\314\314\374\1\314\314\314w\234\0\0\0\0\2"
-  "\0\201\0a\0\200\0\375\211\0\200\0\377\1\0\200\0\311\320\0\0\0\0\1\307"
-  "\307\307\40\206\314\314\314\375\1\314\314\314w\235\0\0\0\0\2\0\200\0"
-  "b\0\200\0\375\210\0\200\0\377\1\0\201\0K\320\0\0\0\0\1\307\307\307\40"
-  "\206\314\314\314\376\1\314\314\314x\236\0\0\0\0\2\0\201\0c\0\200\0\375"
-  "\206\0\200\0\377\1\0\200\0\311\321\0\0\0\0\1\325\325\325\6\206\315\315"
-  "\3153\1\312\312\312\30\237\0\0\0\0\2\0\200\0d\0\200\0\376\205\0\200\0"
-  "\377\1\0\201\0K\371\0\0\0\0\2\0\201\0e\0\200\0\376\203\0\200\0\377\1"
-  "\0\200\0\311\373\0\0\0\0\2\0\200\0f\0\200\0\376\202\0\200\0\377\1\0\200"
-  "\0L\374\0\0\0\0\3\0\201\0o\0\200\0\377\0\200\0\311\376\0\0\0\0\2\0\200"
-  "\0z\0\200\0P\227\0\0\0\0",
-};
-
-
@@ -0,0 +1,64 @@
+/**
+ * X11 request and round-trip counts for the startup profiler.
+ *
+ * Same license as gtk-nodeco.c.
+ *
+ * Requests are read from Xlib's own sequence counter, which costs
+ * nothing. Round trips only with "make PROFILE=1": Xlib runs on top of
+ * XCB and blocks for every reply in xcb_wait_for_reply64, and a
+ * profiling build exports its own definition of that symbol, so libX11's
+ * calls come through here first and are counted before being passed on.
+ * Other builds leave Xlib's replies alone.
+ */
+
+#define _GNU_SOURCE
+#include <gtk/gtk.h>
+#include <gdk/gdkx.h>
+#ifdef GRFKILL_X11_TRACE
+#include <xcb/xcb.h>
+#include <xcb/xcbext.h>
+#include <dlfcn.h>
+#endif
+
+#include "grfkill.h"
+
+#ifdef GRFKILL_X11_TRACE
+
+typedef void *(*WaitForReplyFunc) (xcb_connection_t     *c,
+				   uint64_t              request,
+				   xcb_generic_error_t **e);
+
+static WaitForReplyFunc real_wait_for_reply = NULL;
+static guint round_trips = 0;
+
+void *
+xcb_wait_for_reply64 (xcb_connection_t     *c,
+		      uint64_t              request,
+		      xcb_generic_error_t **e)
+{
+	if (real_wait_for_reply == NULL)
+		real_wait_for_reply = (WaitForReplyFunc) dlsym (RTLD_NEXT, "xcb_wait_for_reply64");
+
+	__atomic_fetch_add (&round_trips, 1, __ATOMIC_RELAXED);
+	return real_wait_for_reply (c, request, e);
+}
+#endif
+
+/* totals since the display was opened; FALSE if round trips aren't counted */
+gboolean
+x11_trace_counts (guint64 *requests,
+		  guint   *trips)
+{
+	GdkDisplay *display = gdk_display_get_default ();
+
+	*requests = 0;
+	if (display != NULL && GDK_IS_X11_DISPLAY (display))
+		*requests = XNextRequest (GDK_DISPLAY_XDISPLAY (display)) - 1;
+#ifdef GRFKILL_X11_TRACE
+	*trips = __atomic_load_n (&round_trips, __ATOMIC_RELAXED);
+	return TRUE;
+#else
+	*trips = 0;
+	return FALSE;
+#endif
+}